@@ -26,6 +26,46 @@ namespace PCGExAssetCollection
 		Order.Sort([&](const int32 A, const int32 B) { return Weights[A] < Weights[B]; });
 		Weights.Sort([](const int32 A, const int32 B) { return A < B; });
 
+		double TotalWeight = 0;
+		for (int32 i = 0; i < NumEntries; i++) { TotalWeight += FMath::Max(0, Weights[i]); }
+
+		// Vose alias table : each slot keeps its own entry with AliasProbabilities[Slot], otherwise falls back to Aliases[Slot].
+		// Weighted picks are then O(1), regardless of the number of entries.
+		PCGEx::InitArray(AliasProbabilities, NumEntries);
+		PCGEx::InitArray(Aliases, NumEntries);
+
+		TArray<int32> Small;
+		TArray<int32> Large;
+		PCGEx::InitArray(Small, NumEntries);
+		PCGEx::InitArray(Large, NumEntries);
+		int32 NumSmall = 0;
+		int32 NumLarge = 0;
+
+		for (int32 i = 0; i < NumEntries; i++)
+		{
+			AliasProbabilities[i] = TotalWeight > 0 ? FMath::Max(0, Weights[i]) * NumEntries / TotalWeight : 1;
+			Aliases[i] = i;
+
+			if (AliasProbabilities[i] < 1) { Small[NumSmall++] = i; }
+			else { Large[NumLarge++] = i; }
+		}
+
+		while (NumSmall && NumLarge)
+		{
+			const int32 Under = Small[--NumSmall];
+			const int32 Over = Large[--NumLarge];
+
+			Aliases[Under] = Over;
+			AliasProbabilities[Over] = (AliasProbabilities[Over] + AliasProbabilities[Under]) - 1;
+
+			if (AliasProbabilities[Over] < 1) { Small[NumSmall++] = Over; }
+			else { Large[NumLarge++] = Over; }
+		}
+
+		// Leftovers are only off by rounding
+		while (NumSmall) { AliasProbabilities[Small[--NumSmall]] = 1; }
+		while (NumLarge) { AliasProbabilities[Large[--NumLarge]] = 1; }
+
 		WeightSum = 0;
 		for (int32 i = 0; i < NumEntries; i++)
 		{
@@ -125,15 +125,9 @@ namespace PCGExDataBlending
 		MergeSingle(UnionIndex, CurrentUnionMetadata->Get(UnionIndex), InDistanceDetails);
 	}
 
-	void FUnionBlender::MergeSingle(const int32 WriteIndex, const TSharedPtr<PCGExData::FUnionData>& InUnionData, const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails)
+	void FUnionBlender::MergeSingle(const int32 WriteIndex, const TConstArrayView<uint64> InUnionItems, const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails)
 	{
-		if (!InUnionData.IsValid())
-		{
-			// TODO : Need to find why
-			// This can happen during task cancellation
-			UE_LOG(LogTemp, Error, TEXT("FUnionBlender::MergeSingle >> NULL UnionData"));
-			return;
-		}
+		if (InUnionItems.IsEmpty()) { return; }
 
 		TArray<int32> IdxIO;
 		TArray<int32> IdxPt;
@@ -141,8 +135,8 @@ namespace PCGExDataBlending
 
 		FPCGPoint& Target = CurrentTargetData->Source->GetMutablePoint(WriteIndex);
 
-		InUnionData->ComputeWeights(
-			Sources, IOIndices,
+		PCGExData::ComputeUnionWeights(
+			InUnionItems, Sources, IOIndices,
 			Target, InDistanceDetails,
 			IdxIO, IdxPt, Weights);
 
@@ -236,7 +230,7 @@ namespace PCGExDataBlending
 		SoftMergeSingle(UnionIndex, CurrentUnionMetadata->Get(UnionIndex), InDistanceDetails);
 	}
 
-	void FUnionBlender::SoftMergeSingle(const int32 UnionIndex, const TSharedPtr<PCGExData::FUnionData>& InUnionData, const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails)
+	void FUnionBlender::SoftMergeSingle(const int32 UnionIndex, const TConstArrayView<uint64> InUnionItems, const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails)
 	{
 		TArray<int32> IdxIO;
 		TArray<int32> IdxPt;
@@ -245,8 +239,8 @@ namespace PCGExDataBlending
 
 		FPCGPoint& Target = CurrentTargetData->Source->GetMutablePoint(UnionIndex);
 
-		InUnionData->ComputeWeights(
-			Sources, IOIndices,
+		PCGExData::ComputeUnionWeights(
+			InUnionItems, Sources, IOIndices,
 			Target, InDistanceDetails,
 			IdxIO, IdxPt, Weights);
 
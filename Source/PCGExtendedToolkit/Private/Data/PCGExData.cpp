@@ -22,6 +22,93 @@ namespace PCGExData
 		return FindBufferUnsafe(UID);
 	}
 
+	FBufferArena::~FBufferArena()
+	{
+		FreeBlocks();
+	}
+
+	void FBufferArena::FreeBlocks()
+	{
+		for (void* Block : Blocks) { FMemory::Free(Block); }
+		Blocks.Empty();
+		Released.Empty();
+
+		Cursor = nullptr;
+		Remaining = 0;
+		NextBlockSize = 0;
+	}
+
+	void* FBufferArena::Allocate(const int64 InSize)
+	{
+		if (InSize <= 0) { return nullptr; }
+
+		const int64 Size = Align(InSize, Alignment);
+
+		FWriteScopeLock WriteScopeLock(ArenaLock);
+
+		NumLiveAllocations++;
+
+		if (TArray<void*>* Recycled = Released.Find(Size); Recycled && !Recycled->IsEmpty())
+		{
+#if PCGEX_ENGINE_VERSION <= 503
+			return Recycled->Pop(false);
+#else
+			return Recycled->Pop(EAllowShrinking::No);
+#endif
+		}
+
+		if (Size > MaxBlockSize / 4)
+		{
+			// Large columns get a block of their own
+			void* Memory = FMemory::Malloc(Size, Alignment);
+			Blocks.Add(Memory);
+			return Memory;
+		}
+
+		if (Size > Remaining)
+		{
+			// Grow geometrically so small facades don't pay for a full block
+			NextBlockSize = FMath::Min(MaxBlockSize, FMath::Max(NextBlockSize * 2, Size * 4));
+			Cursor = static_cast<uint8*>(FMemory::Malloc(NextBlockSize, Alignment));
+			Blocks.Add(Cursor);
+			Remaining = NextBlockSize;
+		}
+
+		void* Memory = Cursor;
+		Cursor += Size;
+		Remaining -= Size;
+
+		return Memory;
+	}
+
+	void FBufferArena::Release(void* InMemory, const int64 InSize)
+	{
+		if (!InMemory || InSize <= 0) { return; }
+
+		const int64 Size = Align(InSize, Alignment);
+
+		FWriteScopeLock WriteScopeLock(ArenaLock);
+
+		NumLiveAllocations--;
+
+		if (Size > MaxBlockSize / 4)
+		{
+			// Standalone blocks go straight back to the allocator
+			Blocks.RemoveSingleSwap(InMemory);
+			FMemory::Free(InMemory);
+			return;
+		}
+
+		Released.FindOrAdd(Size).Add(InMemory);
+	}
+
+	void FBufferArena::Reset()
+	{
+		FWriteScopeLock WriteScopeLock(ArenaLock);
+		if (NumLiveAllocations > 0) { return; }
+		FreeBlocks();
+	}
+
 #pragma endregion
 
 #pragma region FIdxUnion
@@ -241,11 +328,12 @@ namespace PCGExData
 		if (OnCompleteCallback) { OnCompleteCallback(); }
 	}
 
-	void FUnionData::ComputeWeights(
+	void ComputeUnionWeights(
+		const TConstArrayView<uint64> Items,
 		const TArray<TSharedPtr<FFacade>>& Sources, const TMap<uint32, int32>& SourcesIdx, const FPCGPoint& Target,
-		const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails, TArray<int32>& OutIOIdx, TArray<int32>& OutPointsIdx, TArray<double>& OutWeights) const
+		const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails, TArray<int32>& OutIOIdx, TArray<int32>& OutPointsIdx, TArray<double>& OutWeights)
 	{
-		const int32 NumHashes = ItemHashSet.Num();
+		const int32 NumHashes = Items.Num();
 
 		OutPointsIdx.SetNumUninitialized(NumHashes);
 		OutWeights.SetNumUninitialized(NumHashes);
@@ -254,13 +342,22 @@ namespace PCGExData
 		double TotalWeight = 0;
 		int32 Index = 0;
 
-		for (const uint64 Hash : ItemHashSet)
+		// Items are grouped by IOIndex, so the source lookup only happens once per group
+		uint32 CurrentIOIndex = MAX_uint32;
+		const int32* IOIdx = nullptr;
+
+		for (const uint64 Hash : Items)
 		{
 			uint32 IOIndex;
 			uint32 PtIndex;
 			PCGEx::H64(Hash, IOIndex, PtIndex);
 
-			const int32* IOIdx = SourcesIdx.Find(IOIndex);
+			if (IOIndex != CurrentIOIndex)
+			{
+				CurrentIOIndex = IOIndex;
+				IOIdx = SourcesIdx.Find(IOIndex);
+			}
+
 			if (!IOIdx) { continue; }
 
 			OutIOIdx[Index] = *IOIdx;
@@ -273,12 +370,12 @@ namespace PCGExData
 			Index++;
 		}
 
-		if (Index == 0) { return; }
-
 		OutPointsIdx.SetNum(Index);
 		OutWeights.SetNum(Index);
 		OutIOIdx.SetNum(Index);
 
+		if (Index == 0) { return; }
+
 		if (Index == 1)
 		{
 			OutWeights[0] = 1;
@@ -287,7 +384,7 @@ namespace PCGExData
 
 		if (TotalWeight == 0)
 		{
-			const double StaticWeight = 1 / static_cast<double>(ItemHashSet.Num());
+			const double StaticWeight = 1 / static_cast<double>(NumHashes);
 			for (double& Weight : OutWeights) { Weight = StaticWeight; }
 			return;
 		}
@@ -295,35 +392,70 @@ namespace PCGExData
 		for (double& Weight : OutWeights) { Weight = 1 - (Weight / TotalWeight); }
 	}
 
-	uint64 FUnionData::Add(const int32 IOIndex, const int32 PointIndex)
+	bool UnionIOIndexOverlap(const TConstArrayView<uint64> A, const TConstArrayView<uint64> B)
 	{
-		const uint64 H = PCGEx::H64(IOIndex, PointIndex);
+		// Both lists are sorted, hence sorted by IOIndex as well
+		int32 i = 0;
+		int32 j = 0;
 
+		while (i < A.Num() && j < B.Num())
 		{
-			FWriteScopeLock WriteScopeLock(UnionLock);
-			IOIndices.Add(IOIndex);
-			ItemHashSet.Add(H);
+			const uint32 IOA = PCGEx::H64A(A[i]);
+			const uint32 IOB = PCGEx::H64A(B[j]);
+
+			if (IOA == IOB) { return true; }
+			if (IOA < IOB) { i++; }
+			else { j++; }
 		}
 
-		return H;
+		return false;
 	}
 
-	TSharedPtr<FUnionData> FUnionMetadata::NewEntry(const int32 IOIndex, const int32 ItemIndex)
+	void FUnionMetadata::BeginCount(const int32 NumEntries)
 	{
-		TSharedPtr<FUnionData> NewUnionData = Entries.Add_GetRef(MakeShared<FUnionData>());
-		NewUnionData->Add(IOIndex, ItemIndex);
-		return NewUnionData;
+		Offsets.Reset();
+		Offsets.SetNumZeroed(NumEntries + 1);
+		Items.Reset();
+		Cursors.Reset();
 	}
 
-	uint64 FUnionMetadata::Append(const int32 Index, const int32 IOIndex, const int32 ItemIndex)
+	void FUnionMetadata::BeginFill()
 	{
-		return Entries[Index]->Add(IOIndex, ItemIndex);
+		const int32 NumEntries = Num();
+		for (int i = 0; i < NumEntries; i++) { Offsets[i + 1] += Offsets[i]; }
+
+		Items.SetNumUninitialized(Offsets.Last());
+		Cursors.SetNumUninitialized(NumEntries);
+		FMemory::Memcpy(Cursors.GetData(), Offsets.GetData(), NumEntries * sizeof(int32));
 	}
 
-	bool FUnionMetadata::IOIndexOverlap(const int32 InIdx, const TSet<int32>& InIndices)
+	void FUnionMetadata::EndFill()
 	{
-		const TSet<int32> Overlap = Entries[InIdx]->IOIndices.Intersect(InIndices);
-		return Overlap.Num() > 0;
+		Cursors.Empty();
+
+		// Sort & dedupe each entry in place, compacting the storage as we go
+		const int32 NumEntries = Num();
+		int32 WriteIndex = 0;
+		int32 ReadStart = 0;
+
+		for (int i = 0; i < NumEntries; i++)
+		{
+			const int32 ReadEnd = Offsets[i + 1];
+			Offsets[i] = WriteIndex;
+
+			if (ReadEnd - ReadStart > 1) { Algo::Sort(MakeArrayView(Items.GetData() + ReadStart, ReadEnd - ReadStart)); }
+
+			for (int j = ReadStart; j < ReadEnd; j++)
+			{
+				if (j > ReadStart && Items[j] == Items[j - 1]) { continue; }
+				Items[WriteIndex++] = Items[j];
+			}
+
+			ReadStart = ReadEnd;
+		}
+
+		Offsets[NumEntries] = WriteIndex;
+		Items.SetNum(WriteIndex);
 	}
 
 
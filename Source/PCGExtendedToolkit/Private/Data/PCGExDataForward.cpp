@@ -167,7 +167,7 @@ namespace PCGExData
 						TSharedPtr<TBuffer<T>> Writer = InTargetDataFacade->GetWritable<T>(SourceAtt, EBufferInit::New);
 
 						const T ForwardValue = SourceAtt->GetValueFromItemKey(SourceDataFacade->Source->GetInPoint(SourceIndex).MetadataEntry);
-						TArray<T>& Values = *Writer->GetOutValues();
+						TColumn<T>& Values = *Writer->GetOutValues();
 						for (T& Value : Values) { Value = ForwardValue; }
 					});
 			}
@@ -36,6 +36,11 @@ namespace PCGExPointFilter
 	bool FFilter::Test(const PCGExCluster::FNode& Node) const { return Test(Node.PointIndex); }
 	bool FFilter::Test(const PCGExGraph::FEdge& Edge) const { return Test(Edge.PointIndex); }
 
+	void FFilter::TestScope(const PCGExMT::FScope& Scope, TBitArray<>& OutResults) const
+	{
+		PackScope(Scope, OutResults, [&](const int32 Index) { return Test(Index); });
+	}
+
 	bool FSimpleFilter::Test(const int32 Index) const PCGEX_NOT_IMPLEMENTED_RET(TEdgeFilter::Test(const PCGExCluster::FNode& Node), false)
 	bool FSimpleFilter::Test(const PCGExCluster::FNode& Node) const { return Test(Node.PointIndex); }
 	bool FSimpleFilter::Test(const PCGExGraph::FEdge& Edge) const { return Test(Edge.PointIndex); }
@@ -65,6 +70,23 @@ namespace PCGExPointFilter
 		return true;
 	}
 
+	void FManager::TestScope(const PCGExMT::FScope& Scope, TArray<int8>& OutResults)
+	{
+		TBitArray<> ScopeResults;
+		TBitArray<> FilterResults;
+
+		ScopeResults.Init(true, Scope.Count);
+
+		for (const TSharedPtr<FFilter>& Handler : ManagedFilters)
+		{
+			Handler->TestScope(Scope, FilterResults);
+			AndScope(ScopeResults, FilterResults);
+			if (IsUniformScope(ScopeResults, false)) { break; }
+		}
+
+		UnpackScope(Scope, ScopeResults, OutResults);
+	}
+
 	bool FManager::Test(const PCGExCluster::FNode& Node)
 	{
 		for (const TSharedPtr<FFilter>& Handler : ManagedFilters) { if (!Handler->Test(Node)) { return false; } }
@@ -46,7 +46,7 @@ namespace PCGExPointStates
 		// TODO : Implement
 	}
 
-	FStateManager::FStateManager(const TSharedPtr<TArray<int64>>& InFlags, const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
+	FStateManager::FStateManager(const TSharedPtr<PCGExData::TColumn<int64>>& InFlags, const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 		: FManager(InPointDataFacade)
 	{
 		FlagsCache = InFlags;
@@ -68,6 +68,12 @@ namespace PCGExPointStates
 		for (const TSharedPtr<FState>& State : States) { State->ProcessFlags(State->Test(Index), Flags); }
 		return true;
 	}
+
+	void FStateManager::TestScope(const PCGExMT::FScope& Scope, TArray<int8>& OutResults)
+	{
+		// States write flags as they go, keep them on the per-index path
+		for (int i = Scope.Start; i < Scope.End; i++) { OutResults[i] = Test(i); }
+	}
 }
 
 UPCGExParamFactoryBase* UPCGExPointStateFactoryProviderSettings::CreateFactory(FPCGExContext* InContext, UPCGExParamFactoryBase* InFactory) const
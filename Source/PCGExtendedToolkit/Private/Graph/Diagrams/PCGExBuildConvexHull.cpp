@@ -91,7 +91,7 @@ namespace PCGExConvexHull
 		ActivePositions.Empty();
 
 		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
-		Edges = Delaunay->DelaunayEdges.Array();
+		Edges = Delaunay->DelaunayEdges;
 
 		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
 		StartParallelLoopForRange(Edges.Num());
@@ -107,8 +107,8 @@ namespace PCGExConvexHull
 		uint32 A;
 		uint32 B;
 		PCGEx::H64(Edge, A, B);
-		const bool bAIsOnHull = Delaunay->DelaunayHull.Contains(A);
-		const bool bBIsOnHull = Delaunay->DelaunayHull.Contains(B);
+		const bool bAIsOnHull = Delaunay->DelaunayHull[A];
+		const bool bBIsOnHull = Delaunay->DelaunayHull[B];
 
 		if (!bAIsOnHull || !bBIsOnHull)
 		{
@@ -152,7 +152,7 @@ namespace PCGExConvexHull2D
 
 		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
 
-		Edges = Delaunay->DelaunayEdges.Array();
+		Edges = Delaunay->DelaunayEdges;
 
 		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
 		StartParallelLoopForRange(Edges.Num());
@@ -168,8 +168,8 @@ namespace PCGExConvexHull2D
 		uint32 A;
 		uint32 B;
 		PCGEx::H64(Edge, A, B);
-		const bool bAIsOnHull = Delaunay->DelaunayHull.Contains(A);
-		const bool bBIsOnHull = Delaunay->DelaunayHull.Contains(B);
+		const bool bAIsOnHull = Delaunay->DelaunayHull[A];
+		const bool bBIsOnHull = Delaunay->DelaunayHull[B];
 
 		if (!bAIsOnHull || !bBIsOnHull)
 		{
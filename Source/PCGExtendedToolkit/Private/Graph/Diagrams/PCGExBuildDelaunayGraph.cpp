@@ -137,7 +137,7 @@ namespace PCGExBuildDelaunay
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-		HullMarkPointWriter->GetMutable(Index) = Delaunay->DelaunayHull.Contains(Index);
+		HullMarkPointWriter->GetMutable(Index) = Delaunay->DelaunayHull[Index];
 	}
 
 	void FProcessor::CompleteWork()
@@ -198,7 +198,7 @@ namespace PCGExBuildDelaunay
 			PCGEX_MAKE_SHARED(HullBuffer, PCGExData::TBuffer<bool>, SitesIO.ToSharedRef(), Settings->SiteHullAttributeName)
 			HullBuffer->PrepareWrite(false, true, PCGExData::EBufferInit::New);
 			{
-				TArray<bool>& OutValues = *HullBuffer->GetOutValues();
+				PCGExData::TColumn<bool>& OutValues = *HullBuffer->GetOutValues();
 				for (int i = 0; i < NumSites; i++) { OutValues[i] = static_cast<bool>(Delaunay->Sites[i].bOnHull); }
 			}
 			Write(AsyncManager, HullBuffer);
@@ -240,7 +240,7 @@ namespace PCGExBuildDelaunay
 			PCGEX_MAKE_SHARED(HullBuffer, PCGExData::TBuffer<bool>, SitesIO.ToSharedRef(), Settings->SiteHullAttributeName)
 			HullBuffer->PrepareWrite(false, true, PCGExData::EBufferInit::New);
 			{
-				TArray<bool>& OutValues = *HullBuffer->GetOutValues();
+				PCGExData::TColumn<bool>& OutValues = *HullBuffer->GetOutValues();
 				for (int i = 0; i < NumSites; i++) { OutValues[i] = static_cast<bool>(Delaunay->Sites[i].bOnHull); }
 			}
 			Write(AsyncManager, HullBuffer);
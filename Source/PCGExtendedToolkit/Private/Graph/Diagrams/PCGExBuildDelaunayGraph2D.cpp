@@ -146,7 +146,7 @@ namespace PCGExBuildDelaunay2D
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-		HullMarkPointWriter->GetMutable(Index) = Delaunay->DelaunayHull.Contains(Index);
+		HullMarkPointWriter->GetMutable(Index) = Delaunay->DelaunayHull[Index];
 	}
 
 	void FProcessor::CompleteWork()
@@ -209,7 +209,7 @@ namespace PCGExBuildDelaunay2D
 			PCGEX_MAKE_SHARED(HullBuffer, PCGExData::TBuffer<bool>, SitesIO.ToSharedRef(), Settings->SiteHullAttributeName)
 			HullBuffer->PrepareWrite(false, true, PCGExData::EBufferInit::New);
 			{
-				TArray<bool>& OutValues = *HullBuffer->GetOutValues();
+				PCGExData::TColumn<bool>& OutValues = *HullBuffer->GetOutValues();
 				for (int i = 0; i < NumSites; i++) { OutValues[i] = Delaunay->Sites[i].bOnHull; }
 			}
 			Write(AsyncManager, HullBuffer);
@@ -315,7 +315,7 @@ namespace PCGExBuildDelaunay2D
 			PCGEX_MAKE_SHARED(HullBuffer, PCGExData::TBuffer<bool>, SitesIO.ToSharedRef(), Settings->SiteHullAttributeName)
 			HullBuffer->PrepareWrite(false, true, PCGExData::EBufferInit::New);
 			{
-				TArray<bool>& OutValues = *HullBuffer->GetOutValues();
+				PCGExData::TColumn<bool>& OutValues = *HullBuffer->GetOutValues();
 				for (int i = 0; i < Hull.Num(); i++) { OutValues[i] = Hull[i]; }
 			}
 			Write(AsyncManager, HullBuffer);
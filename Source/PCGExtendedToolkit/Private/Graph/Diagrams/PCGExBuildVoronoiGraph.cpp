@@ -112,7 +112,7 @@ namespace PCGExBuildVoronoi
 			TArray<FPCGPoint>& MutableSites = SitesIO->GetOut()->GetMutablePoints();
 			for (int i = 0; i < OriginalSites.Num(); i++)
 			{
-				if (Voronoi->Delaunay->DelaunayHull.Contains(i)) { continue; }
+				if (Voronoi->Delaunay->DelaunayHull[i]) { continue; }
 				MutableSites.Add(OriginalSites[i]);
 			}
 		};
@@ -220,7 +220,7 @@ namespace PCGExBuildVoronoi
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-		//HullMarkPointWriter->Values[Index] = Voronoi->Delaunay->DelaunayHull.Contains(Index);
+		//HullMarkPointWriter->Values[Index] = Voronoi->Delaunay->DelaunayHull[Index];
 	}
 
 	void FProcessor::CompleteWork()
@@ -146,7 +146,7 @@ namespace PCGExBuildVoronoi2D
 			DelaunaySitesInfluenceCount.Init(0, DelaunaySitesNum);
 			IsVtxValid.Init(true, DelaunaySitesNum);
 
-			for (int i = 0; i < IsVtxValid.Num(); i++) { IsVtxValid[i] = !Voronoi->Delaunay->DelaunayHull.Contains(i); }
+			for (int i = 0; i < IsVtxValid.Num(); i++) { IsVtxValid[i] = !Voronoi->Delaunay->DelaunayHull[i]; }
 
 			UpdateSitePosition = [&](const int32 SiteIndex)
 			{
@@ -342,7 +342,7 @@ namespace PCGExBuildVoronoi2D
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-		//HullMarkPointWriter->Values[Index] = Voronoi->Delaunay->DelaunayHull.Contains(Index);
+		//HullMarkPointWriter->Values[Index] = Voronoi->Delaunay->DelaunayHull[Index];
 	}
 
 	void FProcessor::CompleteWork()
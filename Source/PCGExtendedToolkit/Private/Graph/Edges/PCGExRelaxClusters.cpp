@@ -3,6 +3,8 @@
 
 #include "Graph/Edges/PCGExRelaxClusters.h"
 
+#include "Async/TaskGraphInterfaces.h"
+
 
 #include "Graph/Edges/Relaxing/PCGExRelaxClusterOperation.h"
 
@@ -97,35 +99,125 @@ namespace PCGExRelaxClusters
 
 		Iterations = Settings->Iterations;
 
-		StartRelaxIteration();
+		StartRelaxing();
 		return true;
 	}
 
-	void FProcessor::StartRelaxIteration()
+	void FProcessor::StartRelaxing()
 	{
 		if (Iterations <= 0) { return; }
 
-		Iterations--;
-		std::swap(PrimaryBuffer, SecondaryBuffer);
+		PCGExMT::SubLoopScopes(Partitions, NumNodes, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+		PartitionDisplacement.Init(0, Partitions.Num());
 
-		RelaxOperation->ReadBuffer = PrimaryBuffer.Get();
-		RelaxOperation->WriteBuffer = SecondaryBuffer.Get();
+		BeginIteration();
+
+		if (!Settings->bPersistentWorkers)
+		{
+			StartRelaxIteration();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, RelaxGroup)
+
+		PCGEX_SHARED_THIS_DECL
+		RelaxGroup->StartRanges<FRelaxWorkerTask>(
+			FMath::Min(Partitions.Num(), FTaskGraphInterface::Get().GetNumWorkerThreads() + 1), 1,
+			false, ThisPtr);
+	}
 
+	void FProcessor::StartRelaxIteration()
+	{
 		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, IterationGroup)
 
 		IterationGroup->OnCompleteCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
 				PCGEX_ASYNC_THIS
+				if (This->ShouldStop()) { return; }
+				This->BeginIteration();
 				This->StartRelaxIteration();
 			};
 
+		// Same chunk size as the partitions, so each range's loop index is its partition index
 		PCGEX_SHARED_THIS_DECL
 		IterationGroup->StartRanges<FRelaxRangeTask>(
 			NumNodes, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize(),
 			false, ThisPtr);
 	}
 
+	void FProcessor::RunIterations()
+	{
+		const int32 NumPartitions = Partitions.Num();
+		int32 LocalGeneration = Generation.load(std::memory_order_acquire);
+
+		while (!bStopIterating.load(std::memory_order_acquire))
+		{
+			if (const int32 PartitionIndex = NextPartition.fetch_add(1, std::memory_order_acq_rel); PartitionIndex < NumPartitions)
+			{
+				ProcessPartition(PartitionIndex);
+				if (CompletedPartitions.fetch_add(1, std::memory_order_acq_rel) + 1 == NumPartitions) { EndIteration(); }
+				continue;
+			}
+
+			// Everything has been claimed already; what remains is being processed by running workers,
+			// so waiting on them can't stall.
+			while (Generation.load(std::memory_order_acquire) == LocalGeneration && !bStopIterating.load(std::memory_order_acquire)) { FPlatformProcess::Yield(); }
+			LocalGeneration = Generation.load(std::memory_order_acquire);
+		}
+	}
+
+	bool FProcessor::ShouldStop() const
+	{
+		if (Iterations <= 0 || !AsyncManager->IsAvailable()) { return true; }
+		if (!Settings->bStopOnConvergence) { return false; }
+
+		double MaxDisplacement = 0;
+		for (const double Displacement : PartitionDisplacement) { MaxDisplacement = FMath::Max(MaxDisplacement, Displacement); }
+		return MaxDisplacement <= FMath::Square(Settings->ConvergenceThreshold);
+	}
+
+	void FProcessor::BeginIteration()
+	{
+		Iterations--;
+		std::swap(PrimaryBuffer, SecondaryBuffer);
+
+		RelaxOperation->ReadBuffer = PrimaryBuffer.Get();
+		RelaxOperation->WriteBuffer = SecondaryBuffer.Get();
+		RelaxOperation->PrepareStep();
+	}
+
+	void FProcessor::EndIteration()
+	{
+		if (ShouldStop())
+		{
+			bStopIterating.store(true, std::memory_order_release);
+		}
+		else
+		{
+			BeginIteration();
+			CompletedPartitions.store(0, std::memory_order_relaxed);
+			NextPartition.store(0, std::memory_order_release);
+		}
+
+		Generation.fetch_add(1, std::memory_order_release);
+	}
+
+	void FProcessor::ProcessPartition(const int32 PartitionIndex)
+	{
+		const PCGExMT::FScope& Scope = Partitions[PartitionIndex];
+		for (int i = Scope.Start; i < Scope.End; i++) { ProcessSingleNode(i, *Cluster->GetNode(i), Scope); }
+
+		if (!Settings->bStopOnConvergence) { return; }
+
+		const TArray<FVector>& ReadBuffer = *RelaxOperation->ReadBuffer;
+		const TArray<FVector>& WriteBuffer = *RelaxOperation->WriteBuffer;
+
+		double MaxDisplacement = 0;
+		for (int i = Scope.Start; i < Scope.End; i++) { MaxDisplacement = FMath::Max(MaxDisplacement, FVector::DistSquared(ReadBuffer[i], WriteBuffer[i])); }
+		PartitionDisplacement[PartitionIndex] = MaxDisplacement;
+	}
+
 	void FProcessor::ProcessSingleNode(const int32 Index, PCGExCluster::FNode& Node, const PCGExMT::FScope& Scope)
 	{
 		RelaxOperation->ProcessExpandedNode(Node);
@@ -170,7 +262,12 @@ namespace PCGExRelaxClusters
 
 	void FRelaxRangeTask::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
-		for (int i = Scope.Start; i < Scope.End; i++) { Processor->ProcessSingleNode(i, *Processor->Cluster->GetNode(i), Scope); }
+		Processor->ProcessPartition(Scope.LoopIndex);
+	}
+
+	void FRelaxWorkerTask::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
+	{
+		Processor->RunIterations();
 	}
 }
 
@@ -102,6 +102,7 @@ namespace PCGExCluster
 		Bounds = OriginalCluster->Bounds;
 
 		BoundedEdges = OriginalCluster->BoundedEdges;
+		Adjacency = OriginalCluster->Adjacency; // Copied nodes still view the original adjacency
 
 		if (bCopyNodes)
 		{
@@ -180,7 +181,7 @@ namespace PCGExCluster
 	}
 
 	bool FCluster::BuildFrom(
-		const TMap<uint32, int32>& InEndpointsLookup,
+		const TArray<uint64>& InEndpointsLookup,
 		const TArray<int32>* InExpectedAdjacency,
 		const PCGExData::ESource PointsSource)
 	{
@@ -215,7 +216,17 @@ namespace PCGExCluster
 		PCGEx::InitArray(Edges, NumEdges);
 		Nodes->Reserve(InNodePoints.Num());
 
-		const TArray<int64>& Endpoints = *EndpointsBuffer->GetInValues().Get();
+		const PCGExData::TColumn<int64>& Endpoints = *EndpointsBuffer->GetInValues().Get();
+
+		const bool bFlatAdjacency = GetDefault<UPCGExGlobalSettings>()->bFlatClusterAdjacency;
+
+		// Endpoints resolve against the flat, batch-shared lookup; nodes are created in first-seen order
+		// and adjacency is laid out afterward from the resolved {StartNode, EndNode} pairs.
+
+		TArray<int32> EdgeNodes;
+		EdgeNodes.SetNumUninitialized(NumEdges * 2);
+
+		FEdge* EdgesData = Edges->GetData();
 
 		for (int i = 0; i < NumEdges; i++)
 		{
@@ -223,20 +234,20 @@ namespace PCGExCluster
 			uint32 B;
 			PCGEx::H64(Endpoints[i], A, B);
 
-			const int32* StartPointIndexPtr = InEndpointsLookup.Find(A);
-			const int32* EndPointIndexPtr = InEndpointsLookup.Find(B);
-
-			if ((!StartPointIndexPtr || !EndPointIndexPtr || *StartPointIndexPtr == *EndPointIndexPtr)) { return OnFail(); }
+			const int32 StartPointIndex = PCGExGraph::FindEndpoint(InEndpointsLookup, A);
+			const int32 EndPointIndex = PCGExGraph::FindEndpoint(InEndpointsLookup, B);
 
-			const int32 StartNode = GetOrCreateNodeUnsafe(InNodePoints, *StartPointIndexPtr);
-			const int32 EndNode = GetOrCreateNodeUnsafe(InNodePoints, *EndPointIndexPtr);
+			if (StartPointIndex == -1 || EndPointIndex == -1 || StartPointIndex == EndPointIndex) { return OnFail(); }
 
-			(Nodes->GetData() + StartNode)->Link(EndNode, i);
-			(Nodes->GetData() + EndNode)->Link(StartNode, i);
+			EdgeNodes[i * 2] = GetOrCreateNodeUnsafe(InNodePoints, StartPointIndex);
+			EdgeNodes[i * 2 + 1] = GetOrCreateNodeUnsafe(InNodePoints, EndPointIndex);
 
-			*(Edges->GetData() + i) = FEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+			*(EdgesData + i) = FEdge(i, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 		}
 
+		if (bFlatAdjacency) { BuildFlatAdjacency(EdgeNodes); }
+		else { BuildOwnedAdjacency(EdgeNodes); }
+
 		if (InExpectedAdjacency)
 		{
 			for (const FNode& Node : (*Nodes))
@@ -274,19 +285,90 @@ namespace PCGExCluster
 
 		const int32 NumEdges = Edges->Num();
 
+		const bool bFlatAdjacency = GetDefault<UPCGExGlobalSettings>()->bFlatClusterAdjacency;
+
+		TArray<int32> EdgeNodes;
+		EdgeNodes.SetNumUninitialized(NumEdges * 2);
+
 		for (int i = 0; i < NumEdges; i++)
 		{
 			const FEdge* E = Edges->GetData() + i;
-			const int32 StartNode = GetOrCreateNodeUnsafe(TempLookup, SubVtxPoints, E->Start);
-			const int32 EndNode = GetOrCreateNodeUnsafe(TempLookup, SubVtxPoints, E->End);
-
-			(Nodes->GetData() + StartNode)->Link(EndNode, E->Index);
-			(Nodes->GetData() + EndNode)->Link(StartNode, E->Index);
+			EdgeNodes[i * 2] = GetOrCreateNodeUnsafe(TempLookup, SubVtxPoints, E->Start);
+			EdgeNodes[i * 2 + 1] = GetOrCreateNodeUnsafe(TempLookup, SubVtxPoints, E->End);
 		}
 
+		if (bFlatAdjacency) { BuildFlatAdjacency(EdgeNodes); }
+		else { BuildOwnedAdjacency(EdgeNodes); }
+
 		Bounds = Bounds.ExpandBy(10);
 	}
 
+	void FCluster::BuildFlatAdjacency(const TArray<int32>& InEdgeNodes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildFlatAdjacency);
+
+		// InEdgeNodes holds {StartNode, EndNode} pairs, in edge order.
+		// Links are scattered in that same order so adjacency ordering matches per-node Link()
+
+		const int32 NumNodes = Nodes->Num();
+		const int32 NumEdges = Edges->Num();
+
+		TArray<int32> Offsets;
+		Offsets.Init(0, NumNodes + 1);
+
+		// Pass 1 : count degrees
+		for (const int32 NodeIndex : InEdgeNodes) { Offsets[NodeIndex + 1]++; }
+		for (int i = 0; i < NumNodes; i++) { Offsets[i + 1] += Offsets[i]; }
+
+		Adjacency = MakeShared<TArray<FLink>>();
+		PCGEx::InitArray(Adjacency, InEdgeNodes.Num());
+
+		FLink* AdjacencyData = Adjacency->GetData();
+
+		// Pass 2 : scatter links
+		TArray<int32> Cursors = Offsets;
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const int32 EdgeIndex = (Edges->GetData() + i)->Index;
+			const int32 StartNode = InEdgeNodes[i * 2];
+			const int32 EndNode = InEdgeNodes[i * 2 + 1];
+
+			*(AdjacencyData + Cursors[StartNode]++) = FLink(EndNode, EdgeIndex);
+			*(AdjacencyData + Cursors[EndNode]++) = FLink(StartNode, EdgeIndex);
+		}
+
+		FNode* NodesData = Nodes->GetData();
+		for (int i = 0; i < NumNodes; i++) { (NodesData + i)->Links.View(AdjacencyData + Offsets[i], Offsets[i + 1] - Offsets[i]); }
+	}
+
+	void FCluster::BuildOwnedAdjacency(const TArray<int32>& InEdgeNodes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildOwnedAdjacency);
+
+		// Same layout as BuildFlatAdjacency, but each node owns its links.
+		// Edge indices are unique, so links can be appended without AddUnique's linear scan.
+
+		const int32 NumNodes = Nodes->Num();
+		const int32 NumEdges = Edges->Num();
+
+		TArray<int32> Degrees;
+		Degrees.Init(0, NumNodes);
+		for (const int32 NodeIndex : InEdgeNodes) { Degrees[NodeIndex]++; }
+
+		FNode* NodesData = Nodes->GetData();
+		for (int i = 0; i < NumNodes; i++) { (NodesData + i)->Links.Reserve(Degrees[i]); }
+
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const int32 EdgeIndex = (Edges->GetData() + i)->Index;
+			const int32 StartNode = InEdgeNodes[i * 2];
+			const int32 EndNode = InEdgeNodes[i * 2 + 1];
+
+			(NodesData + StartNode)->Links.Add(FLink(EndNode, EdgeIndex));
+			(NodesData + EndNode)->Links.Add(FLink(StartNode, EdgeIndex));
+		}
+	}
+
 	bool FCluster::IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const
 	{
 		return NumRawVtx == InVtxIO->GetNum() && NumRawEdges == InEdgesIO->GetNum();
@@ -65,7 +65,7 @@ namespace PCGExGraph
 		WeakBuilder = InBuilder;
 		WeakAsyncManager = AsyncManager;
 
-		TArray<int32> EdgeDump = Edges.Array();
+		const TArray<int32>& EdgeDump = Edges;
 		const int32 NumEdges = EdgeDump.Num();
 
 		PCGEx::InitArray(FlattenedEdges, NumEdges);
@@ -232,10 +232,12 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 		const uint64 Hash = PCGEx::H64U(A, B);
 
+		IndexEdgesUnsafe();
 		if (UniqueEdges.Contains(Hash)) { return false; }
 
 		OutEdge = Edges.Emplace_GetRef(Edges.Num(), A, B, -1, IOIndex);
 		UniqueEdges.Add(Hash, (OutEdge.Index = Edges.Num() - 1));
+		NumIndexedEdges = Edges.Num();
 
 		Nodes[A].LinkEdge(OutEdge.Index);
 		Nodes[B].LinkEdge(OutEdge.Index);
@@ -252,10 +254,13 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	bool FGraph::InsertEdgeUnsafe(const FEdge& Edge)
 	{
 		uint64 H = Edge.H64U();
+
+		IndexEdgesUnsafe();
 		if (UniqueEdges.Contains(H)) { return false; }
 
 		FEdge& NewEdge = Edges.Emplace_GetRef(Edge);
 		UniqueEdges.Add(H, (NewEdge.Index = Edges.Num() - 1));
+		NumIndexedEdges = Edges.Num();
 
 		Nodes[Edge.Start].LinkEdge(NewEdge.Index);
 		Nodes[Edge.End].LinkEdge(NewEdge.Index);
@@ -285,6 +290,8 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		uint32 A;
 		uint32 B;
 
+		IndexEdgesUnsafe();
+
 		for (const uint64& E : InEdges)
 		{
 			if (UniqueEdges.Contains(E)) { continue; }
@@ -296,6 +303,8 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 			Nodes[B].LinkEdge(EdgeIndex);
 			Edges[EdgeIndex].IOIndex = InIOIndex;
 		}
+
+		NumIndexedEdges = Edges.Num();
 	}
 
 	int32 FGraph::InsertEdges(const TArray<FEdge>& InEdges)
@@ -310,6 +319,9 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	{
 		uint32 A;
 		uint32 B;
+
+		IndexEdgesUnsafe();
+
 		for (const uint64& E : InEdges)
 		{
 			if (UniqueEdges.Contains(E)) { continue; }
@@ -321,6 +333,130 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 			Nodes[B].LinkEdge(EdgeIndex);
 			Edges[EdgeIndex].IOIndex = InIOIndex;
 		}
+
+		NumIndexedEdges = Edges.Num();
+	}
+
+	void FGraph::InsertEdges(TArray<TArray<uint64>>&& InBuckets, const int32 InIOIndex, const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FCompletionCallback&& OnComplete)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdgesBulk);
+
+		PendingEdgeBuckets = MoveTemp(InBuckets);
+		PendingEdgeBuckets.RemoveAll([](const TArray<uint64>& Bucket) { return Bucket.IsEmpty(); });
+
+		if (PendingEdgeBuckets.IsEmpty())
+		{
+			OnComplete();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, SortEdgeBucketsTask)
+
+		SortEdgeBucketsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, InIOIndex, WeakManager = TWeakPtr<PCGExMT::FTaskManager>(AsyncManager), OnComplete = MoveTemp(OnComplete)]() mutable
+			{
+				PCGEX_ASYNC_THIS
+				const TSharedPtr<PCGExMT::FTaskManager> Manager = WeakManager.Pin();
+				if (!Manager) { return; }
+				This->MergeEdgeBuckets(InIOIndex, Manager, MoveTemp(OnComplete));
+			};
+
+		SortEdgeBucketsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				for (int i = Scope.Start; i < Scope.End; i++) { SortUniqueEdgeHashes(This->PendingEdgeBuckets[i]); }
+			};
+
+		SortEdgeBucketsTask->StartSubLoops(PendingEdgeBuckets.Num(), 1);
+	}
+
+	void FGraph::MergeEdgeBuckets(const int32 InIOIndex, const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FCompletionCallback&& OnComplete)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::MergeEdgeBuckets);
+
+		// Edges already in the graph are looked up read-only while slices are merged
+		IndexEdgesUnsafe();
+
+		// Hashes lead with their highest node index, so slicing the node range yields slices that are sorted relative to each other
+		int32 NumHashes = 0;
+		for (const TArray<uint64>& Bucket : PendingEdgeBuckets) { NumHashes += Bucket.Num(); }
+
+		const int32 NumSlices = FMath::Clamp(NumHashes / GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize(), 1, FMath::Max(1, Nodes.Num()));
+		PendingEdgeSlices.SetNum(NumSlices);
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, MergeEdgeSlicesTask)
+
+		MergeEdgeSlicesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, InIOIndex, OnComplete = MoveTemp(OnComplete)]()
+			{
+				PCGEX_ASYNC_THIS
+				This->AppendEdgeSlices(InIOIndex);
+				OnComplete();
+			};
+
+		MergeEdgeSlicesTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, NumSlices](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+
+				const int64 NumNodes = This->Nodes.Num();
+
+				for (int s = Scope.Start; s < Scope.End; s++)
+				{
+					const uint64 From = PCGEx::H64(static_cast<uint32>(NumNodes * s / NumSlices), 0);
+					const uint64 To = s == NumSlices - 1 ? MAX_uint64 : PCGEx::H64(static_cast<uint32>(NumNodes * (s + 1) / NumSlices), 0);
+
+					TArray<uint64>& Slice = This->PendingEdgeSlices[s];
+
+					for (const TArray<uint64>& Bucket : This->PendingEdgeBuckets)
+					{
+						const int32 Start = Algo::LowerBound(Bucket, From);
+						const int32 End = To == MAX_uint64 ? Bucket.Num() : Algo::LowerBound(Bucket, To);
+						if (End > Start) { Slice.Append(Bucket.GetData() + Start, End - Start); }
+					}
+
+					SortUniqueEdgeHashes(Slice);
+
+					if (!This->UniqueEdges.IsEmpty())
+					{
+						Slice.RemoveAll([&](const uint64 Hash) { return This->UniqueEdges.Contains(Hash); });
+					}
+				}
+			};
+
+		MergeEdgeSlicesTask->StartSubLoops(NumSlices, 1);
+	}
+
+	void FGraph::AppendEdgeSlices(const int32 InIOIndex)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::AppendEdgeSlices);
+
+		PendingEdgeBuckets.Empty();
+
+		int32 NumNewEdges = 0;
+		for (const TArray<uint64>& Slice : PendingEdgeSlices) { NumNewEdges += Slice.Num(); }
+
+		// New edges are not registered in UniqueEdges; it is caught up lazily if an incremental insertion or lookup needs it
+		Edges.Reserve(Edges.Num() + NumNewEdges);
+
+		uint32 A;
+		uint32 B;
+
+		for (const TArray<uint64>& Slice : PendingEdgeSlices)
+		{
+			for (const uint64 Hash : Slice)
+			{
+				PCGEx::H64(Hash, A, B);
+				const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B, -1, InIOIndex);
+
+				// Edge indices are new, no need for LinkEdge's AddUnique
+				Nodes[A].Links.Add(FLink(0, EdgeIndex));
+				Nodes[B].Links.Add(FLink(0, EdgeIndex));
+			}
+		}
+
+		PendingEdgeSlices.Empty();
 	}
 
 	void FGraph::InsertEdges(const TSet<uint64>& InEdges, const int32 InIOIndex)
@@ -344,74 +480,223 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	}
 
 
-	void FGraph::BuildSubGraphs(const FPCGExGraphBuilderDetails& Limits)
+	void FGraph::BuildSubGraphs(const FPCGExGraphBuilderDetails* Limits, const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FCompletionCallback&& OnComplete)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs);
 
-		TBitArray<> VisitedNodes;
-		TBitArray<> VisitedEdges;
-		VisitedNodes.Init(false, Nodes.Num());
-		VisitedEdges.Init(false, Edges.Num());
+		SubGraphs.Reset();
+
+		if (Edges.IsEmpty())
+		{
+			OnComplete();
+			return;
+		}
+
+		PCGEx::ArrayOfIndices(Components, Nodes.Num());
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, UniteComponentsTask)
+
+		UniteComponentsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, Limits, WeakManager = TWeakPtr<PCGExMT::FTaskManager>(AsyncManager), OnComplete = MoveTemp(OnComplete)]() mutable
+			{
+				PCGEX_ASYNC_THIS
+
+				const TSharedPtr<PCGExMT::FTaskManager> Manager = WeakManager.Pin();
+				PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, ResolveComponentsTask)
+
+				ResolveComponentsTask->OnCompleteCallback =
+					[AsyncThis, Limits, WeakManager, OnComplete = MoveTemp(OnComplete)]() mutable
+					{
+						PCGEX_ASYNC_NESTED_THIS
+						NestedThis->GatherSubGraphs(Limits, WeakManager.Pin(), MoveTemp(OnComplete));
+					};
+
+				ResolveComponentsTask->OnSubLoopStartCallback =
+					[AsyncThis](const PCGExMT::FScope& Scope)
+					{
+						PCGEX_ASYNC_NESTED_THIS
+						for (int i = Scope.Start; i < Scope.End; i++)
+						{
+							NestedThis->Components[i] = NestedThis->FindComponent(i);
+							NestedThis->Nodes[i].NumExportedEdges = 0;
+						}
+					};
+
+				ResolveComponentsTask->StartSubLoops(This->Nodes.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+			};
+
+		UniteComponentsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					const FEdge& Edge = This->Edges[i];
+					if (!Edge.bValid || !This->Nodes[Edge.Start].bValid || !This->Nodes[Edge.End].bValid) { continue; }
+					This->UniteComponents(Edge.Start, Edge.End);
+				}
+			};
+
+		UniteComponentsTask->StartSubLoops(Edges.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	int32 FGraph::FindComponent(int32 Index)
+	{
+		int32* Parents = Components.GetData();
+
+		while (true)
+		{
+			const int32 Parent = FPlatformAtomics::AtomicRead(Parents + Index);
+			if (Parent == Index) { return Index; }
+
+			// Path halving; parents only ever point to lower indices, so concurrent writes can't form a cycle
+			const int32 GrandParent = FPlatformAtomics::AtomicRead(Parents + Parent);
+			if (GrandParent != Parent) { FPlatformAtomics::InterlockedCompareExchange(Parents + Index, GrandParent, Parent); }
 
-		int32 VisitedNum = 0;
+			Index = GrandParent;
+		}
+	}
+
+	void FGraph::UniteComponents(int32 A, int32 B)
+	{
+		int32* Parents = Components.GetData();
 
-		for (int i = 0; i < Nodes.Num(); i++)
+		while (true)
 		{
-			const FNode& CurrentNode = Nodes[i];
+			A = FindComponent(A);
+			B = FindComponent(B);
 
-			if (VisitedNodes[i]) { continue; }
+			if (A == B) { return; }
 
-			VisitedNodes[i] = true;
-			VisitedNum++;
+			// Always link the higher root under the lower one, so each component ends up rooted on its lowest node whatever the order
+			if (A < B) { Swap(A, B); }
+			if (FPlatformAtomics::InterlockedCompareExchange(Parents + A, B, A) == A) { return; }
+		}
+	}
+
+	void FGraph::GatherSubGraphs(const FPCGExGraphBuilderDetails* Limits, const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FCompletionCallback&& OnComplete)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::GatherSubGraphs);
 
-			if (!CurrentNode.bValid || CurrentNode.IsEmpty()) { continue; }
+		const int32 NumNodes = Nodes.Num();
+
+		// Edges per component root & nodes that have at least one of them
+		TArray<int32> SubGraphIndices;
+		SubGraphIndices.Init(0, NumNodes);
+
+		TBitArray<> Used;
+		Used.Init(false, NumNodes);
+
+		for (const FEdge& Edge : Edges)
+		{
+			if (!Edge.bValid || !Nodes[Edge.Start].bValid || !Nodes[Edge.End].bValid) { continue; }
+			SubGraphIndices[Components[Edge.Start]]++;
+			Used[Edge.Start] = true;
+			Used[Edge.End] = true;
+		}
+
+		// Roots are the lowest node of their component, so this matches a scan for unvisited nodes
+		const TSharedPtr<FGraph> ThisPtr = SharedThis(this);
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const int32 NumSubGraphEdges = SubGraphIndices[i];
+			if (!NumSubGraphEdges)
+			{
+				SubGraphIndices[i] = -1;
+				continue;
+			}
 
 			PCGEX_MAKE_SHARED(SubGraph, FSubGraph)
-			SubGraph->WeakParentGraph = SharedThis(this);
+			SubGraph->WeakParentGraph = ThisPtr;
+			SubGraph->Edges.Reserve(NumSubGraphEdges);
+
+			SubGraphIndices[i] = SubGraphs.Add(SubGraph.ToSharedRef());
+		}
+
+		for (int i = 0; i < NumNodes; i++) { if (Used[i]) { SubGraphs[SubGraphIndices[Components[i]]]->Nodes.Add(i); } }
+
+		Components.Empty();
+
+		VisitedNodes.Init(0, NumNodes);
+		VisitedEdges.Init(0, Edges.Num());
+
+		if (SubGraphs.IsEmpty())
+		{
+			OnComplete();
+			return;
+		}
 
-			TArray<int32> Stack;
-			Stack.Reserve(Nodes.Num() - VisitedNum);
-			Stack.Add(i);
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, FinalizeSubGraphsTask)
 
-			while (Stack.Num() > 0)
+		FinalizeSubGraphsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, Limits, OnComplete = MoveTemp(OnComplete)]()
 			{
-#if PCGEX_ENGINE_VERSION <= 503
-				const int32 NextIndex = Stack.Pop(false);
-#else
-				const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
-#endif
-				FNode& Node = Nodes[NextIndex];
-				Node.NumExportedEdges = 0;
+				PCGEX_ASYNC_THIS
+				This->VisitedNodes.Empty();
+				This->VisitedEdges.Empty();
+				This->SubGraphs.RemoveAll([Limits](const TSharedRef<FSubGraph>& SubGraph) { return !Limits->IsValid(SubGraph); });
+				OnComplete();
+			};
+
+		FinalizeSubGraphsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, Limits](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
 
-				for (const FLink Lk : Node.Links)
+				// Subgraphs don't share nodes nor edges
+				TArray<int32> Stack;
+				for (int i = Scope.Start; i < Scope.End; i++)
 				{
-					const int32 E = Lk.Edge;
+					const TSharedRef<FSubGraph>& SubGraph = This->SubGraphs[i];
+					This->WalkSubGraph(SubGraph, Stack);
+					if (!Limits->IsValid(SubGraph)) { SubGraph->Invalidate(This.Get()); }
+				}
+			};
 
-					if (VisitedEdges[E]) { continue; }
-					VisitedEdges[E] = true;
+		FinalizeSubGraphsTask->StartSubLoops(SubGraphs.Num(), 1);
+	}
+
+	void FGraph::WalkSubGraph(const TSharedRef<FSubGraph>& SubGraph, TArray<int32>& Stack)
+	{
+		// Depth-first from the lowest node, so edges come out in discovery order
+		// and each node counts the edges it discovered first.
+		// Edges leading outside the subgraph are skipped before being flagged, so walks never write outside their own subgraph.
+		Stack.Reset();
+		Stack.Add(SubGraph->Nodes[0]);
+		VisitedNodes[SubGraph->Nodes[0]] = 1;
+
+		while (!Stack.IsEmpty())
+		{
+#if PCGEX_ENGINE_VERSION <= 503
+			const int32 NextIndex = Stack.Pop(false);
+#else
+			const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
+#endif
+			FNode& Node = Nodes[NextIndex];
 
-					const FEdge& Edge = Edges[E];
+			for (const FLink Lk : Node.Links)
+			{
+				const int32 E = Lk.Edge;
+				const FEdge& Edge = Edges[E];
 
-					if (!Edge.bValid) { continue; }
+				if (!Edge.bValid) { continue; }
 
-					const int32 OtherIndex = Edge.Other(NextIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
+				const int32 OtherIndex = Edge.Other(NextIndex);
+				if (!Nodes[OtherIndex].bValid) { continue; }
 
-					Node.NumExportedEdges++;
-					SubGraph->Add(Edge, this);
+				if (VisitedEdges[E]) { continue; }
+				VisitedEdges[E] = 1;
 
-					if (!VisitedNodes[OtherIndex]) // Only enqueue if not already visited
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNum++;
+				Node.NumExportedEdges++;
+				SubGraph->Edges.Add(E);
+				if (Edge.IOIndex >= 0) { SubGraph->EdgesInIOIndices.Add(Edge.IOIndex); }
 
-						Stack.Add(OtherIndex);
-					}
+				if (!VisitedNodes[OtherIndex])
+				{
+					VisitedNodes[OtherIndex] = 1;
+					Stack.Add(OtherIndex);
 				}
 			}
-
-			if (!Limits.IsValid(SubGraph)) { SubGraph->Invalidate(this); } // Will invalidate isolated points
-			else if (!SubGraph->Edges.IsEmpty()) { SubGraphs.Add(SubGraph.ToSharedRef()); }
 		}
 	}
 
@@ -454,7 +739,18 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		NodeIndexLookup = MakeShared<PCGEx::FIndexLookup>(Graph->Nodes.Num()); // Likely larger than exported size; required for compilation.
 		Graph->NodeIndexLookup = NodeIndexLookup;
 
-		Graph->BuildSubGraphs(*OutputDetails);
+		Graph->BuildSubGraphs(
+			OutputDetails, AsyncManager,
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->CompileSubGraphs();
+			});
+	}
+
+	void FGraphBuilder::CompileSubGraphs()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::CompileSubGraphs);
 
 		if (Graph->SubGraphs.IsEmpty())
 		{
@@ -469,94 +765,182 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 		NodeDataFacade->Source->CleanupKeys(); //Ensure fresh keys later on
 
-		TArray<FNode>& Nodes = Graph->Nodes;
+		// Rebuild point list with only the one used, in node order.
+		// Valid nodes are first counted per scope, then each scope scatters its points at its prefix-summed offset.
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, CountValidNodesTask)
 
-		TArray<int32> InternalValidNodes;
-		TArray<int32>& ValidNodes = InternalValidNodes;
-		if (OutputNodeIndices) { ValidNodes = *OutputNodeIndices; }
+		CountValidNodesTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->PruneOffsets.Init(0, Loops.Num());
+			};
+
+		CountValidNodesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->ScatterValidNodes();
+			};
 
-		ValidNodes.Reserve(Nodes.Num());
+		CountValidNodesTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				const TArray<FNode>& Nodes = This->Graph->Nodes;
+				int32 NumValid = 0;
+				for (int i = Scope.Start; i < Scope.End; i++) { if (Nodes[i].bValid && !Nodes[i].IsEmpty()) { NumValid++; } }
+				This->PruneOffsets[Scope.LoopIndex] = NumValid;
+			};
 
+		CountValidNodesTask->StartSubLoops(Graph->Nodes.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FGraphBuilder::ScatterValidNodes()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::ScatterValidNodes);
+
+		int32 NumValidNodes = 0;
+		for (int32& Offset : PruneOffsets)
 		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::PrunePoints);
+			const int32 Count = Offset;
+			Offset = NumValidNodes;
+			NumValidNodes += Count;
+		}
 
-			UPCGMetadata* OutPointsMetadata = NodeDataFacade->Source->GetOut()->Metadata;
+		PCGEx::InitArray(ValidNodes, NumValidNodes);
+
+		// Points that were filled before are pruned out of the current array,
+		// otherwise the pruned points are gathered from the input.
+		TArray<FPCGPoint>& MutablePoints = NodeDataFacade->GetOut()->GetMutablePoints();
+		const bool bPruneExisting = !MutablePoints.IsEmpty();
 
-			// Rebuild point list with only the one used
-			// to know which are used, we need to prune subgraphs first
-			TArray<FPCGPoint>& MutablePoints = NodeDataFacade->GetOut()->GetMutablePoints();
+		const TArray<FPCGPoint>* SourcePoints = bPruneExisting ? &MutablePoints : &NodeDataFacade->GetIn()->GetPoints();
+		TArray<FPCGPoint>* TargetPoints = bPruneExisting ? &PrunedPoints : &MutablePoints;
 
-			if (!MutablePoints.IsEmpty())
+		PCGEx::InitArray(*TargetPoints, NumValidNodes);
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ScatterValidNodesTask)
+
+		ScatterValidNodesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, bPruneExisting]()
 			{
-				//Assume points were filled before, and remove them from the current array
-				TArray<FPCGPoint> PrunedPoints;
-				PrunedPoints.Reserve(MutablePoints.Num());
+				PCGEX_ASYNC_THIS
 
-				for (FNode& Node : Nodes)
+				if (bPruneExisting)
 				{
-					if (!Node.bValid || Node.IsEmpty()) { continue; }
-					Node.PointIndex = PrunedPoints.Add(MutablePoints[Node.PointIndex]);
-					ValidNodes.Add(Node.Index);
+					This->NodeDataFacade->GetOut()->SetPoints(This->PrunedPoints);
+					This->PrunedPoints.Empty();
 				}
 
-				NodeDataFacade->GetOut()->SetPoints(PrunedPoints);
-				TArray<FPCGPoint>& ValidPoints = NodeDataFacade->GetOut()->GetMutablePoints();
-				for (FPCGPoint& ValidPoint : ValidPoints) { OutPointsMetadata->InitializeOnSet(ValidPoint.MetadataEntry); }
-			}
-			else
-			{
-				const int32 NumMaxNodes = Nodes.Num();
-				MutablePoints.Reserve(NumMaxNodes);
+				This->PruneOffsets.Empty();
+				This->WriteVtxData();
+			};
 
-				const TArray<FPCGPoint> OriginalPoints = NodeDataFacade->GetIn()->GetPoints();
+		ScatterValidNodesTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, SourcePoints, TargetPoints](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				TArray<FNode>& Nodes = This->Graph->Nodes;
+				int32 WriteIndex = This->PruneOffsets[Scope.LoopIndex];
 
-				for (FNode& Node : Nodes)
+				for (int i = Scope.Start; i < Scope.End; i++)
 				{
+					FNode& Node = Nodes[i];
 					if (!Node.bValid || Node.IsEmpty()) { continue; }
-					Node.PointIndex = MutablePoints.Add(OriginalPoints[Node.PointIndex]);
-					OutPointsMetadata->InitializeOnSet(MutablePoints.Last().MetadataEntry);
-					ValidNodes.Add(Node.Index);
+
+					(*TargetPoints)[WriteIndex] = (*SourcePoints)[Node.PointIndex];
+					Node.PointIndex = WriteIndex;
+					This->ValidNodes[WriteIndex] = Node.Index;
+					WriteIndex++;
 				}
-			}
+			};
 
-			ValidNodes.Shrink();
-		}
+		ScatterValidNodesTask->StartSubLoops(Graph->Nodes.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
 
-		const TSharedPtr<PCGExData::TBuffer<int64>> VtxEndpointWriter = NodeDataFacade->GetWritable<int64>(Tag_VtxEndpoint, 0, false, PCGExData::EBufferInit::New);
+	void FGraphBuilder::WriteVtxData()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::WriteVtxData);
 
-		const uint32 BaseGUID = NodeDataFacade->GetOut()->GetUniqueID();
-		for (const int32 NodeIndex : ValidNodes)
 		{
-			const FNode& Node = Nodes[NodeIndex];
-			VtxEndpointWriter->GetMutable(Node.PointIndex) = PCGEx::H64(NodeGUID(BaseGUID, Node.PointIndex), Node.NumExportedEdges);
+			TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::InitializeMetadataEntries);
+
+			// Entries are allocated in point order so keys come out the same on every run; this pass stays serial.
+			UPCGMetadata* OutPointsMetadata = NodeDataFacade->Source->GetOut()->Metadata;
+			TArray<FPCGPoint>& ValidPoints = NodeDataFacade->GetOut()->GetMutablePoints();
+			for (FPCGPoint& ValidPoint : ValidPoints) { OutPointsMetadata->InitializeOnSet(ValidPoint.MetadataEntry); }
 		}
 
-		if (MetadataDetails && !Graph->NodeMetadata.IsEmpty())
-		{
+		if (OutputNodeIndices) { *OutputNodeIndices = ValidNodes; }
+
+		const TSharedPtr<PCGExData::TBuffer<int64>> VtxEndpointWriter = NodeDataFacade->GetWritable<int64>(Tag_VtxEndpoint, 0, false, PCGExData::EBufferInit::New);
+
+		const bool bWriteNodeMetadata = MetadataDetailsPtr && !Graph->NodeMetadata.IsEmpty();
+
 #define PCGEX_FOREACH_NODE_METADATA(MACRO)\
-			MACRO(IsPointUnion, bool, false, IsUnion()) \
-			MACRO(PointUnionSize, int32, 0, UnionSize) \
-			MACRO(IsIntersector, bool, false, IsIntersector()) \
-			MACRO(Crossing, bool, false, IsCrossing())
-#define PCGEX_NODE_METADATA_DECL(_NAME, _TYPE, _DEFAULT, _ACCESSOR) const TSharedPtr<PCGExData::TBuffer<_TYPE>> _NAME##Buffer = MetadataDetails->bWrite##_NAME ? NodeDataFacade->GetWritable<_TYPE>(MetadataDetails->_NAME##AttributeName, _DEFAULT, true, PCGExData::EBufferInit::New) : nullptr;
+		MACRO(IsPointUnion, bool, false, IsUnion()) \
+		MACRO(PointUnionSize, int32, 0, UnionSize) \
+		MACRO(IsIntersector, bool, false, IsIntersector()) \
+		MACRO(Crossing, bool, false, IsCrossing())
+#define PCGEX_NODE_METADATA_DECL(_NAME, _TYPE, _DEFAULT, _ACCESSOR) const TSharedPtr<PCGExData::TBuffer<_TYPE>> _NAME##Buffer = bWriteNodeMetadata && MetadataDetailsPtr->bWrite##_NAME ? NodeDataFacade->GetWritable<_TYPE>(MetadataDetailsPtr->_NAME##AttributeName, _DEFAULT, true, PCGExData::EBufferInit::New) : nullptr;
+#define PCGEX_NODE_METADATA_CAPTURE(_NAME, _TYPE, _DEFAULT, _ACCESSOR) , _NAME##Buffer
 #define PCGEX_NODE_METADATA_OUTPUT(_NAME, _TYPE, _DEFAULT, _ACCESSOR) if(_NAME##Buffer){_NAME##Buffer->GetMutable(PointIndex) = NodeMeta->_ACCESSOR;}
 
-			PCGEX_FOREACH_NODE_METADATA(PCGEX_NODE_METADATA_DECL)
+		PCGEX_FOREACH_NODE_METADATA(PCGEX_NODE_METADATA_DECL)
+
+		if (ValidNodes.IsEmpty())
+		{
+			CompileEdges();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, WriteVtxDataTask)
 
-			for (const int32 NodeIndex : ValidNodes)
+		WriteVtxDataTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
-				const FGraphNodeMetadata* NodeMeta = Graph->FindNodeMetadataUnsafe(NodeIndex);
+				PCGEX_ASYNC_THIS
+				This->ValidNodes.Empty();
+				This->CompileEdges();
+			};
 
-				if (!NodeMeta) { continue; }
+		WriteVtxDataTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, VtxEndpointWriter, bWriteNodeMetadata PCGEX_FOREACH_NODE_METADATA(PCGEX_NODE_METADATA_CAPTURE)](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
 
-				const int32 PointIndex = Nodes[NodeIndex].PointIndex;
-				PCGEX_FOREACH_NODE_METADATA(PCGEX_NODE_METADATA_OUTPUT)
-			}
+				const TArray<FNode>& Nodes = This->Graph->Nodes;
+				const uint32 BaseGUID = This->NodeDataFacade->GetOut()->GetUniqueID();
+
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					const FNode& Node = Nodes[This->ValidNodes[i]];
+					const int32 PointIndex = Node.PointIndex;
+
+					VtxEndpointWriter->GetMutable(PointIndex) = PCGEx::H64(NodeGUID(BaseGUID, PointIndex), Node.NumExportedEdges);
+
+					if (!bWriteNodeMetadata) { continue; }
+
+					const FGraphNodeMetadata* NodeMeta = This->Graph->FindNodeMetadataUnsafe(Node.Index);
+					if (!NodeMeta) { continue; }
+
+					PCGEX_FOREACH_NODE_METADATA(PCGEX_NODE_METADATA_OUTPUT)
+				}
+			};
 
 #undef PCGEX_FOREACH_NODE_METADATA
 #undef PCGEX_NODE_METADATA_DECL
+#undef PCGEX_NODE_METADATA_CAPTURE
 #undef PCGEX_NODE_METADATA_OUTPUT
-		}
+
+		WriteVtxDataTask->StartSubLoops(ValidNodes.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FGraphBuilder::CompileEdges()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::CompileEdges);
 
 		bCompiledSuccessfully = true;
 
@@ -11,11 +11,11 @@ namespace PCGExGraph
 	FVector FUnionNode::UpdateCenter(const TSharedPtr<PCGExData::FUnionMetadata>& InUnionMetadata, const TSharedPtr<PCGExData::FPointIOCollection>& IOGroup)
 	{
 		Center = FVector::ZeroVector;
-		const TSharedPtr<PCGExData::FUnionData> UnionData = InUnionMetadata->Get(Index);
+		const TConstArrayView<uint64> UnionItems = InUnionMetadata->Get(Index);
 
-		const double Divider = UnionData->ItemHashSet.Num();
+		const double Divider = UnionItems.Num();
 
-		for (const uint64 H : UnionData->ItemHashSet)
+		for (const uint64 H : UnionItems)
 		{
 			Center += IOGroup->Pairs[PCGEx::H64A(H)]->GetInPoint(PCGEx::H64B(H)).Transform.GetLocation();
 		}
@@ -24,61 +24,90 @@ namespace PCGExGraph
 		return Center;
 	}
 
-	TSharedPtr<FUnionNode> FUnionGraph::InsertPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	namespace
 	{
-		const FVector Origin = Point.Transform.GetLocation();
-		TSharedPtr<FUnionNode> Node;
-
-		if (!Octree)
+		template <bool bThreadSafe>
+		struct TUnionWriteScope
 		{
-			const uint32 GridKey = FuseDetails.GetGridKey(Origin);
-			TSharedPtr<FUnionNode>* NodePtr;
+			FRWLock& Lock;
+
+			explicit TUnionWriteScope(FRWLock& InLock)
+				: Lock(InLock)
 			{
-				FReadScopeLock ReadScopeLock(UnionLock);
-				NodePtr = GridTree.Find(GridKey);
+				if constexpr (bThreadSafe) { Lock.WriteLock(); }
 			}
 
-			if (NodePtr)
+			~TUnionWriteScope() { if constexpr (bThreadSafe) { Lock.WriteUnlock(); } }
+		};
+
+		template <bool bThreadSafe>
+		struct TUnionReadScope
+		{
+			FRWLock& Lock;
+
+			explicit TUnionReadScope(FRWLock& InLock)
+				: Lock(InLock)
 			{
-				Node = *NodePtr;
-				NodesUnion->Append(Node->Index, IOIndex, PointIndex);
-				return Node;
+				if constexpr (bThreadSafe) { Lock.ReadLock(); }
 			}
 
-			{
-				FWriteScopeLock WriteLock(UnionLock);
-				NodePtr = GridTree.Find(GridKey); // Make sure there hasn't been an insert while locking
+			~TUnionReadScope() { if constexpr (bThreadSafe) { Lock.ReadUnlock(); } }
+		};
+	}
 
-				if (NodePtr)
-				{
-					Node = *NodePtr;
-					NodesUnion->Append(Node->Index, IOIndex, PointIndex);
-					return Node;
-				}
+	int32 FUnionGraph::InsertPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	{
+		return InsertPointInternal<true>(Point, IOIndex, PointIndex);
+	}
+
+	int32 FUnionGraph::InsertPointUnsafe(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::InsertPointUnsafe);
+		return InsertPointInternal<false>(Point, IOIndex, PointIndex);
+	}
+
+	template <bool bThreadSafe>
+	int32 FUnionGraph::InsertPointInternal(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	{
+		const FVector Origin = Point.Transform.GetLocation();
+
+		if (!Octree)
+		{
+			// Each grid cell belongs to a single shard, so find-or-create and the union
+			// contribution happen under that shard's lock only.
+			const uint32 GridKey = FuseDetails.GetGridKey(Origin);
+			FUnionShard& Shard = Shards[GetShardIndex(GridKey)];
+
+			TUnionWriteScope<bThreadSafe> WriteScope(Shard.Lock);
 
-				Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-				Nodes.Add(Node);
-				NodesUnion->NewEntry(IOIndex, PointIndex);
-				GridTree.Add(GridKey, Node);
+			int32 NodeIndex;
+			if (const int32* LocalIndex = Shard.GridCells.Find(GridKey))
+			{
+				NodeIndex = Shard.Nodes[*LocalIndex].Index;
+			}
+			else
+			{
+				NodeIndex = NodeCounter.fetch_add(1, std::memory_order_relaxed);
+				Shard.GridCells.Add(GridKey, Shard.Nodes.Num());
+				Shard.Nodes.Emplace(Point, Origin, NodeIndex);
 			}
 
-			return Node;
+			Shard.NodeItems.Emplace(NodeIndex, IOIndex, PointIndex);
+			return NodeIndex;
 		}
 
+		auto FindExisting = [&]()
 		{
-			// Read lock starts
 			int32 NodeIndex = -1;
 
-			FReadScopeLock ReadScopeLock(UnionLock);
-
 			if (FuseDetails.bComponentWiseTolerance)
 			{
 				Octree->FindFirstElementWithBoundsTest(
-					FuseDetails.GetOctreeBox(Origin), [&](const FUnionNode* ExistingNode)
+					FuseDetails.GetOctreeBox(Origin), [&](const FUnionNode& ExistingNode)
 					{
-						if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point))
+						if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode.Point))
 						{
-							NodeIndex = ExistingNode->Index;
+							NodeIndex = ExistingNode.Index;
 							return false;
 						}
 						return true;
@@ -87,230 +116,170 @@ namespace PCGExGraph
 			else
 			{
 				Octree->FindFirstElementWithBoundsTest(
-					FuseDetails.GetOctreeBox(Origin), [&](const FUnionNode* ExistingNode)
+					FuseDetails.GetOctreeBox(Origin), [&](const FUnionNode& ExistingNode)
 					{
-						if (FuseDetails.IsWithinTolerance(Point, ExistingNode->Point))
+						if (FuseDetails.IsWithinTolerance(Point, ExistingNode.Point))
 						{
-							NodeIndex = ExistingNode->Index;
+							NodeIndex = ExistingNode.Index;
 							return false;
 						}
 						return true;
 					});
 			}
 
-			if (NodeIndex != -1)
-			{
-				NodesUnion->Append(NodeIndex, IOIndex, PointIndex);
-				return Nodes[NodeIndex];
-			}
+			return NodeIndex;
+		};
 
-			// Read lock ends
-		}
+		int32 NodeIndex;
 
 		{
-			// Write lock start
-			FWriteScopeLock WriteScopeLock(UnionLock);
-
-			Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-			Nodes.Add(Node);
-			Octree->AddElement(Node.Get());
-			NodesUnion->NewEntry(IOIndex, PointIndex);
+			TUnionReadScope<bThreadSafe> ReadScope(UnionLock);
+			NodeIndex = FindExisting();
 		}
 
-		return Node;
-	}
-
-	TSharedPtr<FUnionNode> FUnionGraph::InsertPointUnsafe(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::InsertPointUnsafe);
-
-		const FVector Origin = Point.Transform.GetLocation();
-		TSharedPtr<FUnionNode> Node;
-
-		if (!Octree)
+		if (NodeIndex == -1)
 		{
-			const uint32 GridKey = FuseDetails.GetGridKey(Origin);
+			TUnionWriteScope<bThreadSafe> WriteScope(UnionLock);
 
-			if (TSharedPtr<FUnionNode>* NodePtr = GridTree.Find(GridKey))
+			// Make sure there hasn't been a matching insert while locking
+			if constexpr (bThreadSafe) { NodeIndex = FindExisting(); }
+
+			if (NodeIndex == -1)
 			{
-				Node = *NodePtr;
-				NodesUnion->Append(Node->Index, IOIndex, PointIndex);
-				return Node;
+				NodeIndex = NodeCounter.fetch_add(1, std::memory_order_relaxed);
+				const FUnionNode NewNode(Point, Origin, NodeIndex);
+				Octree->AddElement(NewNode);
+
+				FUnionShard& Shard = Shards[GetShardIndex(NodeIndex)];
+				TUnionWriteScope<bThreadSafe> ShardScope(Shard.Lock);
+				Shard.Nodes.Add(NewNode);
+				Shard.NodeItems.Emplace(NodeIndex, IOIndex, PointIndex);
+				return NodeIndex;
 			}
-
-			Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-			Nodes.Add(Node);
-			NodesUnion->NewEntry(IOIndex, PointIndex);
-			GridTree.Add(GridKey, Node);
-
-			return Node;
 		}
 
-		int32 NodeIndex = -1;
-
-		if (FuseDetails.bComponentWiseTolerance)
-		{
-			Octree->FindFirstElementWithBoundsTest(
-				FuseDetails.GetOctreeBox(Origin), [&](const FUnionNode* ExistingNode)
-				{
-					if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point))
-					{
-						NodeIndex = ExistingNode->Index;
-						return false;
-					}
-					return true;
-				});
-		}
-		else
-		{
-			Octree->FindFirstElementWithBoundsTest(
-				FuseDetails.GetOctreeBox(Origin), [&](const FUnionNode* ExistingNode)
-				{
-					if (FuseDetails.IsWithinTolerance(Point, ExistingNode->Point))
-					{
-						NodeIndex = ExistingNode->Index;
-						return false;
-					}
-					return true;
-				});
-		}
+		FUnionShard& Shard = Shards[GetShardIndex(NodeIndex)];
+		TUnionWriteScope<bThreadSafe> ShardScope(Shard.Lock);
+		Shard.NodeItems.Emplace(NodeIndex, IOIndex, PointIndex);
 
-		if (NodeIndex != -1)
-		{
-			NodesUnion->Append(NodeIndex, IOIndex, PointIndex);
-			return Nodes[NodeIndex];
-		}
-
-		Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-		Nodes.Add(Node);
-		Octree->AddElement(Node.Get());
-		NodesUnion->NewEntry(IOIndex, PointIndex);
-
-		return Node;
+		return NodeIndex;
 	}
 
-	TSharedPtr<PCGExData::FUnionData> FUnionGraph::InsertEdge(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex, const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex, const int32 EdgeIOIndex, const int32 EdgePointIndex)
+	int32 FUnionGraph::InsertEdge(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex, const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex, const int32 EdgeIOIndex, const int32 EdgePointIndex)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionData::InsertEdge);
+		return InsertEdgeInternal<true>(From, FromIOIndex, FromPointIndex, To, ToIOIndex, ToPointIndex, EdgeIOIndex, EdgePointIndex);
+	}
 
-		const TSharedPtr<FUnionNode> StartVtx = InsertPoint(From, FromIOIndex, FromPointIndex);
-		const TSharedPtr<FUnionNode> EndVtx = InsertPoint(To, ToIOIndex, ToPointIndex);
+	int32 FUnionGraph::InsertEdgeUnsafe(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex, const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex, const int32 EdgeIOIndex, const int32 EdgePointIndex)
+	{
+		return InsertEdgeInternal<false>(From, FromIOIndex, FromPointIndex, To, ToIOIndex, ToPointIndex, EdgeIOIndex, EdgePointIndex);
+	}
 
-		if (StartVtx == EndVtx) { return nullptr; } // Edge got fused entirely
+	template <bool bThreadSafe>
+	int32 FUnionGraph::InsertEdgeInternal(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex, const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex, const int32 EdgeIOIndex, const int32 EdgePointIndex)
+	{
+		const int32 StartIndex = InsertPointInternal<bThreadSafe>(From, FromIOIndex, FromPointIndex);
+		const int32 EndIndex = InsertPointInternal<bThreadSafe>(To, ToIOIndex, ToPointIndex);
 
-		StartVtx->Add(EndVtx->Index);
-		EndVtx->Add(StartVtx->Index);
+		if (StartIndex == EndIndex) { return -1; } // Edge got fused entirely
 
-		TSharedPtr<PCGExData::FUnionData> EdgeUnion;
+		const uint64 H = PCGEx::H64U(StartIndex, EndIndex);
+		FUnionShard& Shard = Shards[GetShardIndex(GetTypeHash(H))];
 
-		const uint64 H = PCGEx::H64U(StartVtx->Index, EndVtx->Index);
+		TUnionWriteScope<bThreadSafe> WriteScope(Shard.Lock);
 
+		int32 LocalIndex;
+		if (const int32* LocalIndexPtr = Shard.EdgeMap.Find(H))
 		{
-			FReadScopeLock ReadLockEdges(EdgesLock);
-			if (const FEdge* Edge = Edges.Find(H)) { EdgeUnion = EdgesUnion->Entries[Edge->Index]; }
+			LocalIndex = *LocalIndexPtr;
 		}
-
-		if (EdgeUnion)
+		else
 		{
-			if (EdgeIOIndex == -1) { EdgeUnion->Add(EdgeIOIndex, EdgeUnion->Num()); } // Abstract tracking to get valid union data
-			else { EdgeUnion->Add(EdgeIOIndex, EdgePointIndex); }
-			return EdgeUnion;
+			LocalIndex = Shard.Edges.Num();
+			Shard.EdgeMap.Add(H, LocalIndex);
+			Shard.Edges.Emplace(EdgeCounter.fetch_add(1, std::memory_order_relaxed), StartIndex, EndIndex);
+			Shard.EdgeUnionSizes.Add(0);
 		}
 
-		{
-			FWriteScopeLock WriteLockEdges(EdgesLock);
-
-			if (const FEdge* Edge = Edges.Find(H)) { EdgeUnion = EdgesUnion->Entries[Edge->Index]; }
+		const int32 EdgeIndex = Shard.Edges[LocalIndex].Index;
+		int32& UnionSize = Shard.EdgeUnionSizes[LocalIndex];
 
-			if (EdgeUnion)
-			{
-				if (EdgeIOIndex == -1) { EdgeUnion->Add(EdgeIOIndex, EdgeUnion->Num()); } // Abstract tracking to get valid union data
-				else { EdgeUnion->Add(EdgeIOIndex, EdgePointIndex); }
-				return EdgeUnion;
-			}
+		int32 ItemIndex = EdgePointIndex;
+		if (EdgeIOIndex == -1) { ItemIndex = UnionSize; } // Abstract tracking to get valid union data
+		else if (UnionSize == 0 && EdgePointIndex == -1) { ItemIndex = 0; }
 
-			EdgeUnion = EdgesUnion->NewEntry(EdgeIOIndex, EdgePointIndex == -1 ? 0 : EdgePointIndex);
-			Edges.Add(H, FEdge(Edges.Num(), StartVtx->Index, EndVtx->Index));
-		}
+		Shard.EdgeItems.Emplace(EdgeIndex, EdgeIOIndex, ItemIndex);
+		UnionSize++;
 
-		return EdgeUnion;
+		return EdgeIndex;
 	}
 
-	TSharedPtr<PCGExData::FUnionData> FUnionGraph::InsertEdgeUnsafe(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex, const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex, const int32 EdgeIOIndex, const int32 EdgePointIndex)
+	void FUnionGraph::Finalize()
 	{
-		const TSharedPtr<FUnionNode> StartVtx = InsertPointUnsafe(From, FromIOIndex, FromPointIndex);
-		const TSharedPtr<FUnionNode> EndVtx = InsertPointUnsafe(To, ToIOIndex, ToPointIndex);
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::Finalize);
 
-		if (StartVtx == EndVtx) { return nullptr; } // Edge got fused entirely
+		if (bFinalized) { return; }
+		bFinalized = true;
 
-		StartVtx->Adjacency.Add(EndVtx->Index);
-		EndVtx->Adjacency.Add(StartVtx->Index);
+		const int32 NumNodes = NodeCounter.load();
+		const int32 NumEdges = EdgeCounter.load();
 
-		const uint64 H = PCGEx::H64U(StartVtx->Index, EndVtx->Index);
-		TSharedPtr<PCGExData::FUnionData> EdgeUnion;
+		Nodes.SetNum(NumNodes);
+		Edges.SetNumUninitialized(NumEdges);
 
-		if (EdgeIOIndex == -1)
+		// Count, then fill flat union storage
+		NodesUnion->BeginCount(NumNodes);
+		EdgesUnion->BeginCount(NumEdges);
+
+		for (const FUnionShard& Shard : Shards)
 		{
-			// Abstract edge management, so we have some valid metadata even tho there are no valid input edges
-			// So EdgeIOIndex will be invalid, be we can still track union data
-			if (const FEdge* Edge = Edges.Find(H))
-			{
-				EdgeUnion = EdgesUnion->Entries[Edge->Index];
-				EdgeUnion->Add(EdgeIOIndex, EdgeUnion->Num());
-			}
-			else
-			{
-				EdgeUnion = EdgesUnion->NewEntry(EdgeIOIndex, 0);
-				Edges.Add(H, FEdge(Edges.Num(), StartVtx->Index, EndVtx->Index));
-			}
+			for (const FUnionItem& Item : Shard.NodeItems) { NodesUnion->Count(Item.Index); }
+			for (const FUnionItem& Item : Shard.EdgeItems) { EdgesUnion->Count(Item.Index); }
 		}
-		else
+
+		NodesUnion->BeginFill();
+		EdgesUnion->BeginFill();
+
+		for (FUnionShard& Shard : Shards)
 		{
-			// Concrete edge management, we have valild input edges			
-			if (const FEdge* Edge = Edges.Find(H))
-			{
-				EdgeUnion = EdgesUnion->Entries[Edge->Index];
-				EdgeUnion->Add(EdgeIOIndex, EdgePointIndex);
-			}
-			else
-			{
-				EdgeUnion = EdgesUnion->NewEntry(EdgeIOIndex, EdgePointIndex);
-				Edges.Add(H, FEdge(Edges.Num(), StartVtx->Index, EndVtx->Index));
-			}
+			for (FUnionNode& Node : Shard.Nodes) { Nodes[Node.Index] = MoveTemp(Node); }
+			for (const FEdge& Edge : Shard.Edges) { Edges[Edge.Index] = Edge; }
+			for (const FUnionItem& Item : Shard.NodeItems) { NodesUnion->Fill(Item.Index, Item.IOIndex, Item.ItemIndex); }
+			for (const FUnionItem& Item : Shard.EdgeItems) { EdgesUnion->Fill(Item.Index, Item.IOIndex, Item.ItemIndex); }
+
+			Shard.GridCells.Empty();
+			Shard.Nodes.Empty();
+			Shard.NodeItems.Empty();
+			Shard.EdgeMap.Empty();
+			Shard.Edges.Empty();
+			Shard.EdgeUnionSizes.Empty();
+			Shard.EdgeItems.Empty();
 		}
 
-		return EdgeUnion;
+		NodesUnion->EndFill();
+		EdgesUnion->EndFill();
 	}
 
 	void FUnionGraph::GetUniqueEdges(TSet<uint64>& OutEdges)
 	{
-		OutEdges.Empty(Nodes.Num() * 4);
-		for (const TSharedPtr<FUnionNode>& Node : Nodes)
-		{
-			for (const int32 OtherNodeIndex : Node->Adjacency)
-			{
-				const uint64 Hash = PCGEx::H64U(Node->Index, OtherNodeIndex);
-				OutEdges.Add(Hash);
-			}
-		}
+		OutEdges.Empty(Edges.Num());
+		for (const FEdge& Edge : Edges) { OutEdges.Add(PCGEx::H64U(Edge.Start, Edge.End)); }
 	}
 
 	void FUnionGraph::GetUniqueEdges(TArray<FEdge>& OutEdges)
 	{
-		const int32 NumEdges = Edges.Num();
-		OutEdges.SetNumUninitialized(NumEdges);
-		for (const TPair<uint64, FEdge>& Pair : Edges) { OutEdges[Pair.Value.Index] = Pair.Value; }
+		OutEdges = Edges;
 	}
 
 	void FUnionGraph::WriteNodeMetadata(const TSharedPtr<FGraph>& InGraph) const
 	{
 		InGraph->NodeMetadata.Reserve(Nodes.Num());
 
-		for (const TSharedPtr<FUnionNode>& Node : Nodes)
+		for (const FUnionNode& Node : Nodes)
 		{
-			const TSharedPtr<PCGExData::FUnionData>& UnionData = NodesUnion->Entries[Node->Index];
-			FGraphNodeMetadata& NodeMeta = InGraph->GetOrCreateNodeMetadataUnsafe(Node->Index);
-			NodeMeta.UnionSize = UnionData->Num();
+			FGraphNodeMetadata& NodeMeta = InGraph->GetOrCreateNodeMetadataUnsafe(Node.Index);
+			NodeMeta.UnionSize = NodesUnion->NumItems(Node.Index);
 		}
 	}
 
@@ -321,9 +290,8 @@ namespace PCGExGraph
 
 		for (int i = 0; i < NumEdges; i++)
 		{
-			const TSharedPtr<PCGExData::FUnionData>& UnionData = EdgesUnion->Entries[i];
 			FGraphEdgeMetadata& EdgeMetadata = InGraph->GetOrCreateEdgeMetadataUnsafe(i);
-			EdgeMetadata.UnionSize = UnionData->Num();
+			EdgeMetadata.UnionSize = EdgesUnion->NumItems(i);
 		}
 		/*
 		for (const TPair<uint64, FIndexedEdge>& Pair : Edges)
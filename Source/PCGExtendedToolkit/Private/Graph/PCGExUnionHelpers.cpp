@@ -53,6 +53,8 @@ namespace PCGExGraph
 	{
 		BuilderDetails = InBuilderDetails;
 
+		UnionGraph->Finalize();
+
 		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
 		if (NumUnionNodes == 0)
 		{
@@ -94,14 +96,14 @@ namespace PCGExGraph
 
 				for (int i = Scope.Start; i < Scope.End; i++)
 				{
-					TSharedPtr<FUnionNode> UnionNode = This->UnionGraph->Nodes[i];
+					FUnionNode& UnionNode = This->UnionGraph->Nodes[i];
 					const PCGMetadataEntryKey Key = Points[i].MetadataEntry;
-					Points[i] = UnionNode->Point; // Copy "original" point properties, in case  there's only one
+					Points[i] = UnionNode.Point; // Copy "original" point properties, in case  there's only one
 
 					FPCGPoint& Point = Points[i];
 					Point.MetadataEntry = Key; // Restore key
 
-					Point.Transform.SetLocation(UnionNode->UpdateCenter(PointsUnion, MainPoints));
+					Point.Transform.SetLocation(UnionNode.UpdateCenter(PointsUnion, MainPoints));
 					Blender->MergeSingle(i, Distances);
 				}
 			};
@@ -27,6 +27,7 @@ namespace PCGExHeuristics
 		for (UPCGExHeuristicOperation* Op : Operations) { ExecutionContext->ManagedObjects->Destroy(Op); }
 
 		Operations.Empty();
+		DynamicOperations.Empty();
 		Feedbacks.Empty();
 	}
 
@@ -50,6 +51,7 @@ namespace PCGExHeuristics
 			Operation = OperationFactory->CreateOperation(InContext);
 
 			if (bIsFeedback) { Feedbacks.Add(Cast<UPCGExHeuristicFeedback>(Operation)); }
+			if (Operation->IsGoalDependent()) { bHasGoalDependentEdgeScore = true; }
 			Operations.Add(Operation);
 
 			PCGEX_INIT_HEURISTIC_OPERATION(Operation, OperationFactory)
@@ -80,6 +82,11 @@ namespace PCGExHeuristics
 
 		Cluster = InCluster;
 		bUseDynamicWeight = false;
+
+		DynamicOperations = Operations;
+		StaticEdgeScores.Empty();
+		EdgeWeights.Empty();
+
 		for (UPCGExHeuristicOperation* Operation : Operations)
 		{
 			Operation->PrepareForCluster(InCluster);
@@ -91,6 +98,47 @@ namespace PCGExHeuristics
 	{
 		TotalStaticWeight = 0;
 		for (const UPCGExHeuristicOperation* Op : Operations) { TotalStaticWeight += Op->WeightFactor; }
+
+		// Bake per-edge & per-direction values that don't depend on the query
+
+		TArray<const UPCGExHeuristicOperation*> StaticOperations;
+		DynamicOperations.Reset();
+
+		for (UPCGExHeuristicOperation* Op : Operations)
+		{
+			if (Op->IsStatic()) { StaticOperations.Add(Op); }
+			else { DynamicOperations.Add(Op); }
+		}
+
+		if (StaticOperations.IsEmpty() && !bUseDynamicWeight) { return; }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FHeuristicsHandler::BakeEdgeScores);
+
+		const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+		const TArray<PCGExGraph::FEdge>& EdgesRef = *Cluster->Edges;
+		const int32 NumSlots = EdgesRef.Num() * 2;
+
+		if (!StaticOperations.IsEmpty()) { StaticEdgeScores.SetNumZeroed(NumSlots); }
+		if (bUseDynamicWeight) { EdgeWeights.SetNumZeroed(NumSlots); }
+
+		for (const PCGExCluster::FNode& From : NodesRef)
+		{
+			for (const PCGExGraph::FLink Lk : From.Links)
+			{
+				const PCGExCluster::FNode& To = NodesRef[Lk.Node];
+				const PCGExGraph::FEdge& Edge = EdgesRef[Lk.Edge];
+				const int32 Slot = GetEdgeSlot(From, Edge);
+
+				if (!StaticOperations.IsEmpty())
+				{
+					double EScore = 0;
+					for (const UPCGExHeuristicOperation* Op : StaticOperations) { EScore += Op->GetEdgeScore(From, To, Edge, From, To); }
+					StaticEdgeScores[Slot] = EScore;
+				}
+
+				if (bUseDynamicWeight) { EdgeWeights[Slot] = GetEdgeWeight(To, Edge); }
+			}
+		}
 	}
 
 	TSharedPtr<FLocalFeedbackHandler> FHeuristicsHandler::MakeLocalFeedbackHandler(const TSharedPtr<const PCGExCluster::FCluster>& InCluster)
@@ -237,9 +237,63 @@ namespace PCGExPathfindingEdge
 				Query->Cleanup();
 			};
 
+		if (Settings->bBatchQueriesPerSeed && SearchOperation->SupportsBatchedQueries(HeuristicsHandler))
+		{
+			// Pairs are generated seed by seed, so queries sharing a seed are contiguous
+			SeedGroups.Reserve(Queries.Num());
+			for (int i = 0; i < Context->SeedGoalPairs.Num(); i++)
+			{
+				if (i == 0 || PCGEx::H64A(Context->SeedGoalPairs[i]) != PCGEx::H64A(Context->SeedGoalPairs[i - 1])) { SeedGroups.Add(i); }
+			}
+
+			if (SeedGroups.Num() < Queries.Num())
+			{
+				ResolveQueriesTask->OnIterationCallback =
+					[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+					{
+						PCGEX_ASYNC_THIS
+						This->ResolveSeedGroup(Index);
+					};
+
+				ResolveQueriesTask->StartIterations(SeedGroups.Num(), 1);
+				return true;
+			}
+
+			SeedGroups.Empty(); // One goal per seed, nothing to share
+		}
+
 		ResolveQueriesTask->StartIterations(Queries.Num(), 1, HeuristicsHandler->HasGlobalFeedback());
 		return true;
 	}
+
+	void FProcessor::ResolveSeedGroup(const int32 GroupIndex)
+	{
+		const int32 Start = SeedGroups[GroupIndex];
+		const int32 End = SeedGroups.IsValidIndex(GroupIndex + 1) ? SeedGroups[GroupIndex + 1] : Queries.Num();
+
+		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> Batch;
+		Batch.Reserve(End - Start);
+
+		for (int i = Start; i < End; i++)
+		{
+			const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[i];
+			Query->ResolvePicks(Settings->SeedPicking, Settings->GoalPicking);
+			if (Query->HasValidEndpoints()) { Batch.Add(Query); }
+		}
+
+		if (Batch.IsEmpty()) { return; }
+
+		if (Batch.Num() == 1) { Batch[0]->FindPath(SearchOperation, HeuristicsHandler, nullptr); }
+		else { SearchOperation->ResolveBatchedQueries(Batch, HeuristicsHandler); }
+
+		for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : Batch)
+		{
+			if (!Query->IsQuerySuccessful()) { continue; }
+
+			Context->BuildPath(Query);
+			Query->Cleanup();
+		}
+	}
 }
 
 
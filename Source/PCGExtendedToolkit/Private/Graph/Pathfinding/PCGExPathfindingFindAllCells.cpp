@@ -132,35 +132,49 @@ namespace PCGExFindAllCells
 		if (Settings->Constraints.bOmitWrappingBounds) { CellsConstraints->BuildWrapperCell(Cluster.ToSharedRef(), *ProjectedPositions); }
 		CellsConstraints->Holes = Context->Holes;
 
-		StartParallelLoopForEdges(32); // Might be overkill low
+		// Each face is walked exactly once, from its lowest half-edge leaving a node that isn't binary
+		PlanarFaces = MakeShared<PCGExTopology::FPlanarFaces>(Cluster.ToSharedRef(), *ProjectedPositions);
 
-		return true;
-	}
+		FaceSeeds.Init(-1, PlanarFaces->Faces.Num());
+		for (int i = 0; i < PlanarFaces->HalfEdges.Num(); i++)
+		{
+			const int32 FaceIndex = PlanarFaces->FaceIndices[i];
+			if (FaceIndex < 0 || FaceSeeds[FaceIndex] != -1) { continue; }
 
-	void FProcessor::ProcessSingleEdge(const int32 EdgeIndex, PCGExGraph::FEdge& Edge, const PCGExMT::FScope& Scope)
-	{
-		//Check endpoints
-		FindCell(*Cluster->GetEdgeStart(Edge), Edge);
-		FindCell(*Cluster->GetEdgeEnd(Edge), Edge);
-	}
+			const PCGExCluster::FNode* Node = Cluster->GetNode(PlanarFaces->HalfEdges[i].From);
+			if (Node->IsBinary() || (!CellsConstraints->bKeepCellsWithLeaves && Node->IsLeaf())) { continue; }
 
-	bool FProcessor::FindCell(
-		const PCGExCluster::FNode& Node,
-		const PCGExGraph::FEdge& Edge,
-		const bool bSkipBinary)
-	{
-		if (Node.IsBinary() && bSkipBinary)
-		{
-			FPlatformAtomics::InterlockedExchange(&LastBinary, Node.Index);
-			return false;
+			FaceSeeds[FaceIndex] = i;
 		}
 
-		if (!CellsConstraints->bKeepCellsWithLeaves && Node.IsLeaf()) { return false; }
+		FaceSeeds.RemoveAll([](const int32 Seed) { return Seed == -1; });
+
+		// Roaming closed loop, only binary nodes
+		if (FaceSeeds.IsEmpty() && !PlanarFaces->Faces.IsEmpty()) { FaceSeeds.Add(PlanarFaces->Faces[0]); }
+
+		if (FaceSeeds.IsEmpty()) { return true; }
+
+		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, FindCellsTask)
+
+		FindCellsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				for (int i = Scope.Start; i < Scope.End; i++) { This->FindCell(This->FaceSeeds[i]); }
+			};
+
+		FindCellsTask->StartSubLoops(FaceSeeds.Num(), 32); // Might be overkill low
 
-		FPlatformAtomics::InterlockedAdd(&NumAttempts, 1);
+		return true;
+	}
+
+	bool FProcessor::FindCell(const int32 HalfEdge)
+	{
+		const PCGExTopology::FPlanarFaces::FHalfEdge& Start = PlanarFaces->HalfEdges[HalfEdge];
 		const TSharedPtr<PCGExTopology::FCell> Cell = MakeShared<PCGExTopology::FCell>(CellsConstraints.ToSharedRef());
 
-		const PCGExTopology::ECellResult Result = Cell->BuildFromCluster(PCGExGraph::FLink(Node.Index, Edge.Index), Cluster.ToSharedRef(), *ProjectedPositions);
+		const PCGExTopology::ECellResult Result = Cell->BuildFromCluster(
+			PCGExGraph::FLink(Start.From, Start.Edge), Cluster.ToSharedRef(), *ProjectedPositions, PlanarFaces.Get());
 		if (Result != PCGExTopology::ECellResult::Success) { return false; }
 
 		ProcessCell(Cell);
@@ -200,7 +214,7 @@ namespace PCGExFindAllCells
 		if (Settings->bFlagLeaves)
 		{
 			const TSharedPtr<PCGExData::TBuffer<bool>> LeavesBuffer = PathDataFacade->GetWritable(Settings->LeafAttributeName, false, true, PCGExData::EBufferInit::New);
-			TArray<bool>& OutValues = *LeavesBuffer->GetOutValues();
+			PCGExData::TColumn<bool>& OutValues = *LeavesBuffer->GetOutValues();
 			for (int i = 0; i < Cell->Nodes.Num(); i++) { OutValues[i] = Cluster->GetNode(Cell->Nodes[i])->Num() == 1; }
 		}
 
@@ -219,22 +233,6 @@ namespace PCGExFindAllCells
 		*/
 	}
 
-	void FProcessor::EnsureRoamingClosedLoopProcessing()
-	{
-		if (NumAttempts == 0 && LastBinary != -1)
-		{
-			PCGEX_MAKE_SHARED(Cell, PCGExTopology::FCell, CellsConstraints.ToSharedRef())
-			PCGExGraph::FEdge& Edge = *Cluster->GetEdge(Cluster->GetNode(LastBinary)->Links[0].Edge);
-			FindCell(*Cluster->GetEdgeStart(Edge), Edge, false);
-		}
-	}
-
-	void FProcessor::OnEdgesProcessingComplete()
-	{
-		EnsureRoamingClosedLoopProcessing();
-		TProcessor<FPCGExFindAllCellsContext, UPCGExFindAllCellsSettings>::OnEdgesProcessingComplete();
-	}
-
 	void FProcessor::CompleteWork()
 	{
 		if (!CellsConstraints->WrapperCell) { return; }
@@ -245,6 +243,7 @@ namespace PCGExFindAllCells
 	{
 		TProcessor<FPCGExFindAllCellsContext, UPCGExFindAllCellsSettings>::Cleanup();
 		CellsConstraints->Cleanup();
+		PlanarFaces.Reset();
 	}
 
 	void FBatch::Process()
@@ -21,22 +21,15 @@ bool UPCGExSearchAStar::ResolveQuery(
 	const PCGExCluster::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExCluster::FNode& GoalNode = *InQuery->Goal.Node;
 
-	const int32 NumNodes = NodesRef.Num();
-
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchAStar::FindPath);
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
-
-	const TSharedPtr<PCGEx::FHashLookup> TravelStack = PCGEx::NewHashLookup<PCGEx::FArrayHashLookup>(PCGEx::NH64(-1, -1), NumNodes);
-
-	TArray<double> GScore;
-	GScore.Init(-1, NumNodes);
+	const PCGExSearch::FScopedWorkspace Workspace(WorkspacePool);
 
-	const TUniquePtr<PCGExSearch::FScoredQueue> ScoredQueue = MakeUnique<PCGExSearch::FScoredQueue>(
-		NumNodes, SeedNode.Index, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = Workspace->TravelStack;
+	PCGExSearch::FScoredQueue* ScoredQueue = Workspace->ScoredQueue.Get();
 
-	GScore[SeedNode.Index] = 0;
+	ScoredQueue->Enqueue(SeedNode.Index, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
+	Workspace->SetGScore(SeedNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
@@ -47,11 +40,11 @@ bool UPCGExSearchAStar::ResolveQuery(
 	{
 		if (CurrentNodeIndex == GoalNode.Index) { break; } // Exit early
 
-		const double CurrentGScore = GScore[CurrentNodeIndex];
+		const double CurrentGScore = Workspace->GetGScore(CurrentNodeIndex);
 		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Workspace->IsVisited(CurrentNodeIndex)) { continue; }
+		Workspace->SetVisited(CurrentNodeIndex);
 		VisitedNum++;
 
 		for (const PCGExGraph::FLink Lk : Current.Links)
@@ -59,7 +52,7 @@ bool UPCGExSearchAStar::ResolveQuery(
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Workspace->IsVisited(NeighborIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
@@ -67,11 +60,11 @@ bool UPCGExSearchAStar::ResolveQuery(
 			const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
 			const double TentativeGScore = CurrentGScore + EScore;
 
-			const double PreviousGScore = GScore[NeighborIndex];
+			const double PreviousGScore = Workspace->GetGScore(NeighborIndex);
 			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 			TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-			GScore[NeighborIndex] = TentativeGScore;
+			Workspace->SetGScore(NeighborIndex, TentativeGScore);
 
 			const double GS = Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode, Feedback);
 			const double FScore = TentativeGScore + GS * Heuristics->ReferenceWeight;
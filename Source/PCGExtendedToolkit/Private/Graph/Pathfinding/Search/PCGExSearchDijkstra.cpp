@@ -14,6 +14,11 @@ void UPCGExSearchDijkstra::CopySettingsFrom(const UPCGExOperation* Other)
 	Super::CopySettingsFrom(Other);
 }
 
+bool UPCGExSearchDijkstra::SupportsBatchedQueries(const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics) const
+{
+	return Heuristics && Heuristics->CanShareSearchTree();
+}
+
 bool UPCGExSearchDijkstra::ResolveQuery(
 	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 	const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
@@ -25,19 +30,16 @@ bool UPCGExSearchDijkstra::ResolveQuery(
 	const PCGExCluster::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExCluster::FNode& GoalNode = *InQuery->Goal.Node;
 
-	const int32 NumNodes = NodesRef.Num();
-
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindPath);
 
 	// Basic Dijkstra implementation
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
+	const PCGExSearch::FScopedWorkspace Workspace(WorkspacePool);
 
-	const TSharedPtr<PCGEx::FHashLookup> TravelStack = PCGEx::NewHashLookup<PCGEx::FArrayHashLookup>(PCGEx::NH64(-1, -1), NumNodes);
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = Workspace->TravelStack;
+	PCGExSearch::FScoredQueue* ScoredQueue = Workspace->ScoredQueue.Get();
 
-	const TUniquePtr<PCGExSearch::FScoredQueue> ScoredQueue = MakeUnique<PCGExSearch::FScoredQueue>(
-		NumNodes, SeedNode.Index, 0);
+	ScoredQueue->Enqueue(SeedNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
@@ -50,8 +52,8 @@ bool UPCGExSearchDijkstra::ResolveQuery(
 
 		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Workspace->IsVisited(CurrentNodeIndex)) { continue; }
+		Workspace->SetVisited(CurrentNodeIndex);
 		VisitedNum++;
 
 		for (const PCGExGraph::FLink Lk : Current.Links)
@@ -59,7 +61,7 @@ bool UPCGExSearchDijkstra::ResolveQuery(
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Workspace->IsVisited(NeighborIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
@@ -13,6 +13,7 @@ void UPCGExSearchOperation::CopySettingsFrom(const UPCGExOperation* Other)
 void UPCGExSearchOperation::PrepareForCluster(PCGExCluster::FCluster* InCluster)
 {
 	Cluster = InCluster;
+	WorkspacePool = MakeShared<PCGExSearch::FSearchWorkspacePool>(Cluster->Nodes->Num());
 }
 
 bool UPCGExSearchOperation::ResolveQuery(
@@ -21,3 +22,99 @@ bool UPCGExSearchOperation::ResolveQuery(
 {
 	return false;
 }
+
+bool UPCGExSearchOperation::SupportsBatchedQueries(const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics) const
+{
+	return false;
+}
+
+void UPCGExSearchOperation::ResolveBatchedQueries(
+	const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>& InQueries,
+	const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics) const
+{
+	if (InQueries.IsEmpty()) { return; }
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchOperation::ResolveBatchedQueries);
+
+	const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraph::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const PCGExCluster::FNode& SeedNode = *InQueries[0]->Seed.Node;
+	const PCGExCluster::FNode& AnyGoalNode = *InQueries[0]->Goal.Node; // Edge scores don't depend on it
+
+	TSet<int32> PendingGoals;
+	PendingGoals.Reserve(InQueries.Num());
+
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries)
+	{
+		check(Query->PickResolution == PCGExPathfinding::EQueryPickResolution::Success)
+		check(Query->Seed.Node->Index == SeedNode.Index)
+		PendingGoals.Add(Query->Goal.Node->Index);
+	}
+
+	// Single-source Dijkstra, stopped as soon as all goals are settled
+
+	const PCGExSearch::FScopedWorkspace Workspace(WorkspacePool);
+
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = Workspace->TravelStack;
+	PCGExSearch::FScoredQueue* ScoredQueue = Workspace->ScoredQueue.Get();
+
+	ScoredQueue->Enqueue(SeedNode.Index, 0);
+
+	int32 CurrentNodeIndex;
+	double CurrentScore;
+	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+	{
+		if (Workspace->IsVisited(CurrentNodeIndex)) { continue; }
+		Workspace->SetVisited(CurrentNodeIndex);
+
+		if (PendingGoals.Remove(CurrentNodeIndex) && PendingGoals.IsEmpty()) { break; }
+
+		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
+
+		for (const PCGExGraph::FLink Lk : Current.Links)
+		{
+			const uint32 NeighborIndex = Lk.Node;
+			const uint32 EdgeIndex = Lk.Edge;
+
+			if (Workspace->IsVisited(NeighborIndex)) { continue; }
+
+			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
+			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
+
+			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, AnyGoalNode, nullptr, TravelStack);
+			if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
+			{
+				TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			}
+		}
+	}
+
+	// Extract each goal path from the tree
+
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries)
+	{
+		const int32 GoalIndex = Query->Goal.Node->Index;
+
+		int32 PathNodeIndex = PCGEx::NH64A(TravelStack->Get(GoalIndex));
+		int32 PathEdgeIndex = -1;
+
+		if (PathNodeIndex == -1)
+		{
+			Query->SetResolution(PCGExPathfinding::EPathfindingResolution::Fail);
+			continue;
+		}
+
+		Query->AddPathNode(GoalIndex);
+
+		while (PathNodeIndex != -1)
+		{
+			const int32 CurrentIndex = PathNodeIndex;
+			PCGEx::NH64(TravelStack->Get(CurrentIndex), PathNodeIndex, PathEdgeIndex);
+
+			Query->AddPathNode(CurrentIndex, PathEdgeIndex);
+		}
+
+		Query->SetResolution(Query->HasValidPathPoints() ? PCGExPathfinding::EPathfindingResolution::Success : PCGExPathfinding::EPathfindingResolution::Fail);
+	}
+}
@@ -14,7 +14,7 @@ bool UPCGExProbeAnisotropic::PrepareForPoints(const TSharedPtr<PCGExData::FPoint
 	return true;
 }
 
-void UPCGExProbeAnisotropic::ProcessCandidates(const int32 Index, const FPCGPoint& Point, TArray<PCGExProbing::FCandidate>& Candidates, TSet<FInt32Vector>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges)
+void UPCGExProbeAnisotropic::ProcessCandidates(const int32 Index, const FPCGPoint& Point, TArray<PCGExProbing::FCandidate>& Candidates, TSet<FInt32Vector>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges)
 {
 	bool bIsAlreadyConnected;
 	const double R = SearchRadiusCache ? SearchRadiusCache->Read(Index) : SearchRadiusSquared;
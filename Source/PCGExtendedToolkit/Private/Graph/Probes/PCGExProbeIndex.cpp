@@ -25,17 +25,17 @@ bool UPCGExProbeIndex::PrepareForPoints(const TSharedPtr<PCGExData::FPointIO>& I
 	case EPCGExIndexSafety::Yoyo:		MACRO(EPCGExIndexSafety::Yoyo, _VALUE) break;	}
 
 #define PCGEX_TARGET_CONNECT_TARGET(_MODE, _VALUE)\
-	TryCreateEdge = [&](const int32 Index, TSet<uint64>* OutEdges) {\
+	TryCreateEdge = [&](const int32 Index, TArray<uint64>* OutEdges) {\
 	const int32 Value = PCGExMath::SanitizeIndex<int32, _MODE>(_VALUE, MaxIndex);\
 	if (Value != -1) { OutEdges->Add(PCGEx::H64U(Index, Value)); }};
 
 #define PCGEX_TARGET_CONNECT_ONEWAY(_MODE, _VALUE)\
-	TryCreateEdge = [&](const int32 Index, TSet<uint64>* OutEdges) {\
+	TryCreateEdge = [&](const int32 Index, TArray<uint64>* OutEdges) {\
 	const int32 Value = PCGExMath::SanitizeIndex<int32, _MODE>(Index + _VALUE, MaxIndex);\
 	if (Value != -1) { OutEdges->Add(PCGEx::H64U(Index, Value)); }};
 
 #define PCGEX_TARGET_CONNECT_TWOWAY(_MODE, _VALUE)\
-	TryCreateEdge = [&](const int32 Index, TSet<uint64>* OutEdges) {\
+	TryCreateEdge = [&](const int32 Index, TArray<uint64>* OutEdges) {\
 	const int32 A = PCGExMath::SanitizeIndex<int32, _MODE>(Index + _VALUE, MaxIndex);\
 	if (A != -1) { OutEdges->Add(PCGEx::H64U(Index, A)); }\
 	const int32 B = PCGExMath::SanitizeIndex<int32, _MODE>(Index - _VALUE, MaxIndex);\
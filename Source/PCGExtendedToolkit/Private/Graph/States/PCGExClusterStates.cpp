@@ -76,7 +76,7 @@ namespace PCGExClusterStates
 	}
 
 	FStateManager::FStateManager(
-		const TSharedPtr<TArray<int64>>& InFlags,
+		const TSharedPtr<PCGExData::TColumn<int64>>& InFlags,
 		const TSharedRef<PCGExCluster::FCluster>& InCluster,
 		const TSharedRef<PCGExData::FFacade>& InPointDataCache,
 		const TSharedRef<PCGExData::FFacade>& InEdgeDataCache)
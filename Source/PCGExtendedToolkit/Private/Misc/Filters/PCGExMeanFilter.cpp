@@ -43,8 +43,7 @@ bool PCGExPointsFilter::TMeanFilter::Init(FPCGExContext* InContext, const TShare
 	DataMin = Target->Min;
 	DataMax = Target->Max;
 
-	Values.Reserve(Target->GetInValues()->Num());
-	Values.Append(*Target->GetInValues());
+	Values.Append(Target->GetInValues()->GetData(), Target->GetInValues()->Num());
 
 	return true;
 }
@@ -49,6 +49,43 @@ bool PCGExPointsFilter::TNumericComparisonFilter::Init(FPCGExContext* InContext,
 	return true;
 }
 
+void PCGExPointsFilter::TNumericComparisonFilter::TestScope(const PCGExMT::FScope& Scope, TBitArray<>& OutResults) const
+{
+	// Resolve the comparison once for the whole scope, so the inner loop is a plain, inlined compare
+	const double Tolerance = TypedFilterFactory->Config.Tolerance;
+
+	switch (TypedFilterFactory->Config.Comparison)
+	{
+	case EPCGExComparison::StrictlyEqual:
+		PackCompare(Scope, OutResults, [](const double A, const double B) { return PCGExCompare::StrictlyEqual(A, B); });
+		break;
+	case EPCGExComparison::StrictlyNotEqual:
+		PackCompare(Scope, OutResults, [](const double A, const double B) { return PCGExCompare::StrictlyNotEqual(A, B); });
+		break;
+	case EPCGExComparison::EqualOrGreater:
+		PackCompare(Scope, OutResults, [](const double A, const double B) { return PCGExCompare::EqualOrGreater(A, B); });
+		break;
+	case EPCGExComparison::EqualOrSmaller:
+		PackCompare(Scope, OutResults, [](const double A, const double B) { return PCGExCompare::EqualOrSmaller(A, B); });
+		break;
+	case EPCGExComparison::StrictlyGreater:
+		PackCompare(Scope, OutResults, [](const double A, const double B) { return PCGExCompare::StrictlyGreater(A, B); });
+		break;
+	case EPCGExComparison::StrictlySmaller:
+		PackCompare(Scope, OutResults, [](const double A, const double B) { return PCGExCompare::StrictlySmaller(A, B); });
+		break;
+	case EPCGExComparison::NearlyEqual:
+		PackCompare(Scope, OutResults, [Tolerance](const double A, const double B) { return PCGExCompare::NearlyEqual(A, B, Tolerance); });
+		break;
+	case EPCGExComparison::NearlyNotEqual:
+		PackCompare(Scope, OutResults, [Tolerance](const double A, const double B) { return PCGExCompare::NearlyNotEqual(A, B, Tolerance); });
+		break;
+	default:
+		FFilter::TestScope(Scope, OutResults);
+		break;
+	}
+}
+
 PCGEX_CREATE_FILTER_FACTORY(NumericCompare)
 
 #if WITH_EDITOR
@@ -35,6 +35,8 @@ bool UPCGExSplineInclusionFilterFactory::Init(FPCGExContext* InContext)
 		return false;
 	}
 
+	SplineIndex = MakeShared<PCGExPaths::FSplineIndex>(Splines);
+
 	return true;
 }
 
@@ -45,6 +47,7 @@ TSharedPtr<PCGExPointFilter::FFilter> UPCGExSplineInclusionFilterFactory::Create
 
 void UPCGExSplineInclusionFilterFactory::BeginDestroy()
 {
+	SplineIndex.Reset();
 	Super::BeginDestroy();
 }
 
@@ -105,9 +108,15 @@ namespace PCGExPointsFilter
 
 		if (TypedFilterFactory->Config.Pick == EPCGExSplineFilterPick::Closest)
 		{
+			// Only splines that may hold the closest point can affect the state
+			TArray<int32> Candidates;
+			if (SplineIndex) { SplineIndex->FindNearestCandidates(Pos, 0, Candidates); }
+			else { PCGEx::ArrayOfIndices(Candidates, Splines->Num()); }
+
 			double ClosestDist = MAX_dbl;
-			for (const FPCGSplineStruct& Spline : *Splines)
+			for (const int32 i : Candidates)
 			{
+				const FPCGSplineStruct& Spline = (*Splines)[i];
 				const FTransform T = PCGExPaths::GetClosestTransform(Spline, Pos, TypedFilterFactory->Config.bSplineScalesTolerance);
 				const FVector& TLoc = T.GetLocation();
 				const double D = FVector::DistSquared(Pos, TLoc);
@@ -139,6 +148,8 @@ namespace PCGExPointsFilter
 				if (const FVector S = T.GetScale3D(); FVector::DistSquared(T.GetLocation(), Pos) < FVector2D(S.Y, S.Z).Length() * ToleranceSquared) { State |= On; }
 				if (FVector::DotProduct(T.GetRotation().GetRightVector(), (TLoc - Pos).GetSafeNormal()) > TypedFilterFactory->Config.CurvatureThreshold) { State |= Inside; }
 				else { State |= Outside; }
+
+				if (State == (Inside | Outside | On)) { break; } // Nothing left to learn from other splines
 			}
 		}
 
@@ -87,19 +87,21 @@ namespace PCGExFusePoints
 	{
 		TArray<FPCGPoint>& MutablePoints = PointDataFacade->GetOut()->GetMutablePoints();
 
-		const TSharedPtr<PCGExGraph::FUnionNode> UnionNode = UnionGraph->Nodes[Iteration];
+		PCGExGraph::FUnionNode& UnionNode = UnionGraph->Nodes[Iteration];
 		const PCGMetadataEntryKey Key = MutablePoints[Iteration].MetadataEntry;
-		MutablePoints[Iteration] = UnionNode->Point; // Copy "original" point properties, in case there's only one
+		MutablePoints[Iteration] = UnionNode.Point; // Copy "original" point properties, in case there's only one
 
 		FPCGPoint& Point = MutablePoints[Iteration];
 		Point.MetadataEntry = Key; // Restore key
 
-		Point.Transform.SetLocation(UnionNode->UpdateCenter(UnionGraph->NodesUnion, Context->MainPoints));
+		Point.Transform.SetLocation(UnionNode.UpdateCenter(UnionGraph->NodesUnion, Context->MainPoints));
 		UnionBlender->MergeSingle(Iteration, Context->Distances);
 	}
 
 	void FProcessor::CompleteWork()
 	{
+		UnionGraph->Finalize();
+
 		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
 		PointDataFacade->Source->GetOut()->GetMutablePoints().SetNum(NumUnionNodes);
 
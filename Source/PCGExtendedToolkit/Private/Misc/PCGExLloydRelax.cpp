@@ -73,67 +73,127 @@ namespace PCGExLloydRelax
 
 		PCGExGeo::PointsToPositions(PointDataFacade->GetIn()->GetPoints(), ActivePositions);
 
-		PCGEX_SHARED_THIS_DECL
-		PCGEX_LAUNCH(FLloydRelaxTask, 0, ThisPtr, &InfluenceDetails, Settings->Iterations)
+		RemainingIterations = Settings->Iterations;
+		StartIteration();
 
 		return true;
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
+	void FProcessor::StartIteration()
 	{
-		Point.Transform.SetLocation(
-			InfluenceDetails.bProgressiveInfluence ?
-				ActivePositions[Index] :
-				FMath::Lerp(Point.Transform.GetLocation(), ActivePositions[Index], InfluenceDetails.GetInfluence(Index)));
+		RemainingIterations--;
+
+		PCGEX_SHARED_THIS_DECL
+		PCGEX_LAUNCH(FLloydRelaxTask, Settings->Iterations - RemainingIterations - 1, ThisPtr)
 	}
 
-	void FProcessor::CompleteWork()
+	bool FProcessor::UpdateTriangulation()
 	{
-		StartParallelLoopForPoints();
+		const TArrayView<FVector> View = MakeArrayView(ActivePositions);
+
+		if (Delaunay && Settings->bReuseTriangulation && Delaunay->IsStillDelaunay(View)) { return true; }
+
+		Delaunay = MakeUnique<PCGExGeo::TDelaunay3>();
+		if (!Delaunay->Process<false, false>(View))
+		{
+			Delaunay.Reset();
+			return false;
+		}
+
+		// Sites using each point, in ascending order so sums accumulate in the same order as a serial pass over sites
+		const int32 NumPoints = ActivePositions.Num();
+		const TArray<PCGExGeo::FDelaunaySite3>& Sites = Delaunay->Sites;
+
+		SiteOffsets.Init(0, NumPoints + 1);
+		for (const PCGExGeo::FDelaunaySite3& Site : Sites) { for (const int32 PtIndex : Site.Vtx) { SiteOffsets[PtIndex + 1]++; } }
+		for (int i = 0; i < NumPoints; i++) { SiteOffsets[i + 1] += SiteOffsets[i]; }
+
+		TArray<int32> Cursors = SiteOffsets;
+		PointSites.SetNumUninitialized(SiteOffsets[NumPoints]);
+		for (int i = 0; i < Sites.Num(); i++) { for (const int32 PtIndex : Sites[i].Vtx) { PointSites[Cursors[PtIndex]++] = i; } }
+
+		Centroids.SetNumUninitialized(Sites.Num());
+
+		return true;
 	}
 
-	void FLloydRelaxTask::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
+	void FProcessor::ComputeCentroids()
 	{
-		NumIterations--;
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, CentroidsTask)
 
-		TUniquePtr<PCGExGeo::TDelaunay3> Delaunay = MakeUnique<PCGExGeo::TDelaunay3>();
-		TArray<FVector>& Positions = Processor->ActivePositions;
+		CentroidsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->ApplyCentroids();
+			};
 
-		//FPCGExPointsProcessorContext* Context = static_cast<FPCGExPointsProcessorContext*>(Manager->Context);
+		CentroidsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				const TArrayView<FVector> View = MakeArrayView(This->ActivePositions);
+				for (int i = Scope.Start; i < Scope.End; i++) { PCGExGeo::GetCentroid(View, This->Delaunay->Sites[i].Vtx, This->Centroids[i]); }
+			};
 
-		const TArrayView<FVector> View = MakeArrayView(Positions);
-		if (!Delaunay->Process<false, false>(View)) { return; }
+		CentroidsTask->StartSubLoops(Centroids.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
 
-		const int32 NumPoints = Positions.Num();
+	void FProcessor::ApplyCentroids()
+	{
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ApplyTask)
 
-		TArray<FVector> Sum;
-		TArray<double> Counts;
-		Sum.Append(Processor->ActivePositions);
-		Counts.SetNum(NumPoints);
-		for (int i = 0; i < NumPoints; i++) { Counts[i] = 1; }
+		ApplyTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				if (This->RemainingIterations > 0) { This->StartIteration(); }
+				else { This->Delaunay.Reset(); }
+			};
 
-		FVector Centroid;
-		for (const PCGExGeo::FDelaunaySite3& Site : Delaunay->Sites)
-		{
-			PCGExGeo::GetCentroid(Positions, Site.Vtx, Centroid);
-			for (const int32 PtIndex : Site.Vtx)
+		ApplyTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
-				Counts[PtIndex] += 1;
-				Sum[PtIndex] += Centroid;
-			}
-		}
+				PCGEX_ASYNC_THIS
 
-		if (InfluenceSettings->bProgressiveInfluence)
-		{
-			for (int i = 0; i < NumPoints; i++) { Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->GetInfluence(i)); }
-		}
+				if (!This->InfluenceDetails.bProgressiveInfluence) { return; }
 
-		Delaunay.Reset();
+				// Each point only reads site centroids & writes itself
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					FVector Sum = This->ActivePositions[i];
+					double Count = 1;
 
-		if (NumIterations > 0)
-		{
-			PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
-		}
+					for (int s = This->SiteOffsets[i]; s < This->SiteOffsets[i + 1]; s++)
+					{
+						Sum += This->Centroids[This->PointSites[s]];
+						Count += 1;
+					}
+
+					This->ActivePositions[i] = FMath::Lerp(This->ActivePositions[i], Sum / Count, This->InfluenceDetails.GetInfluence(i));
+				}
+			};
+
+		ApplyTask->StartSubLoops(ActivePositions.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
+	{
+		Point.Transform.SetLocation(
+			InfluenceDetails.bProgressiveInfluence ?
+				ActivePositions[Index] :
+				FMath::Lerp(Point.Transform.GetLocation(), ActivePositions[Index], InfluenceDetails.GetInfluence(Index)));
+	}
+
+	void FProcessor::CompleteWork()
+	{
+		StartParallelLoopForPoints();
+	}
+
+	void FLloydRelaxTask::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
+	{
+		if (!Processor->UpdateTriangulation()) { return; }
+		Processor->ComputeCentroids();
 	}
 }
 
@@ -77,12 +77,115 @@ namespace PCGExLloydRelax2D
 
 		PCGExGeo::PointsToPositions(PointDataFacade->GetIn()->GetPoints(), ActivePositions);
 
+		RemainingIterations = Settings->Iterations;
+		StartIteration();
+
+		return true;
+	}
+
+	void FProcessor::StartIteration()
+	{
+		RemainingIterations--;
+
 		PCGEX_SHARED_THIS_DECL
-		PCGEX_LAUNCH(FLloydRelaxTask, 0, ThisPtr, &InfluenceDetails, Settings->Iterations)
+		PCGEX_LAUNCH(FLloydRelaxTask, Settings->Iterations - RemainingIterations - 1, ThisPtr)
+	}
+
+	bool FProcessor::UpdateTriangulation()
+	{
+		const TArrayView<FVector> View = MakeArrayView(ActivePositions);
+
+		if (Delaunay && Settings->bReuseTriangulation)
+		{
+			TArray<FVector2D> Positions2D;
+			ProjectionDetails.Project(View, Positions2D);
+			if (Delaunay->IsStillDelaunay(Positions2D)) { return true; }
+		}
+
+		Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
+		if (!Delaunay->Process(View, ProjectionDetails))
+		{
+			Delaunay.Reset();
+			return false;
+		}
+
+		// Sites using each point, in ascending order so sums accumulate in the same order as a serial pass over sites
+		const int32 NumPoints = ActivePositions.Num();
+		const TArray<PCGExGeo::FDelaunaySite2>& Sites = Delaunay->Sites;
+
+		SiteOffsets.Init(0, NumPoints + 1);
+		for (const PCGExGeo::FDelaunaySite2& Site : Sites) { for (const int32 PtIndex : Site.Vtx) { SiteOffsets[PtIndex + 1]++; } }
+		for (int i = 0; i < NumPoints; i++) { SiteOffsets[i + 1] += SiteOffsets[i]; }
+
+		TArray<int32> Cursors = SiteOffsets;
+		PointSites.SetNumUninitialized(SiteOffsets[NumPoints]);
+		for (int i = 0; i < Sites.Num(); i++) { for (const int32 PtIndex : Sites[i].Vtx) { PointSites[Cursors[PtIndex]++] = i; } }
+
+		Centroids.SetNumUninitialized(Sites.Num());
 
 		return true;
 	}
 
+	void FProcessor::ComputeCentroids()
+	{
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, CentroidsTask)
+
+		CentroidsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->ApplyCentroids();
+			};
+
+		CentroidsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				const TArrayView<FVector> View = MakeArrayView(This->ActivePositions);
+				for (int i = Scope.Start; i < Scope.End; i++) { PCGExGeo::GetCentroid(View, This->Delaunay->Sites[i].Vtx, This->Centroids[i]); }
+			};
+
+		CentroidsTask->StartSubLoops(Centroids.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FProcessor::ApplyCentroids()
+	{
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ApplyTask)
+
+		ApplyTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				if (This->RemainingIterations > 0) { This->StartIteration(); }
+				else { This->Delaunay.Reset(); }
+			};
+
+		ApplyTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+
+				if (!This->InfluenceDetails.bProgressiveInfluence) { return; }
+
+				// Each point only reads site centroids & writes itself
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					FVector Sum = This->ActivePositions[i];
+					double Count = 1;
+
+					for (int s = This->SiteOffsets[i]; s < This->SiteOffsets[i + 1]; s++)
+					{
+						Sum += This->Centroids[This->PointSites[s]];
+						Count += 1;
+					}
+
+					This->ActivePositions[i] = FMath::Lerp(This->ActivePositions[i], Sum / Count, This->InfluenceDetails.GetInfluence(i));
+				}
+			};
+
+		ApplyTask->StartSubLoops(ActivePositions.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
 		FVector TargetPosition = Point.Transform.GetLocation();
@@ -102,49 +205,8 @@ namespace PCGExLloydRelax2D
 
 	void FLloydRelaxTask::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
-		NumIterations--;
-
-		TUniquePtr<PCGExGeo::TDelaunay2> Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
-		TArray<FVector>& Positions = Processor->ActivePositions;
-
-		//FPCGExPointsProcessorContext* Context = static_cast<FPCGExPointsProcessorContext*>(Manager->Context);
-
-		const TArrayView<FVector> View = MakeArrayView(Positions);
-		if (!Delaunay->Process(View, Processor->ProjectionDetails)) { return; }
-
-		const int32 NumPoints = Positions.Num();
-
-		TArray<FVector> Sum;
-		TArray<double> Counts;
-		Sum.Append(Processor->ActivePositions);
-		Counts.SetNum(NumPoints);
-		for (int i = 0; i < NumPoints; i++) { Counts[i] = 1; }
-
-		FVector Centroid;
-		for (const PCGExGeo::FDelaunaySite2& Site : Delaunay->Sites)
-		{
-			PCGExGeo::GetCentroid(Positions, Site.Vtx, Centroid);
-			for (const int32 PtIndex : Site.Vtx)
-			{
-				Counts[PtIndex] += 1;
-				Sum[PtIndex] += Centroid;
-			}
-		}
-
-		if (InfluenceSettings->bProgressiveInfluence)
-		{
-			for (int i = 0; i < NumPoints; i++)
-			{
-				Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->GetInfluence(i));
-			}
-		}
-
-		Delaunay.Reset();
-
-		if (NumIterations > 0)
-		{
-			PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
-		}
+		if (!Processor->UpdateTriangulation()) { return; }
+		Processor->ComputeCentroids();
 	}
 }
 
@@ -4,6 +4,7 @@
 
 #include "Misc/PCGExSortPoints.h"
 
+#include "Async/TaskGraphInterfaces.h"
 #include "Misc/PCGExModularSortPoints.h"
 
 
@@ -76,7 +77,7 @@ namespace PCGExSortPoints
 		TArray<FPCGExSortRuleConfig> RuleConfigs;
 		Settings->GetSortingRules(ExecutionContext, RuleConfigs);
 
-		Sorter = MakeShared<PCGExSorting::PointSorter<true>>(Context, PointDataFacade, RuleConfigs);
+		Sorter = MakeShared<PCGExSorting::PointSorter<false>>(Context, PointDataFacade, RuleConfigs);
 		Sorter->SortDirection = Settings->SortDirection;
 		Sorter->RegisterBuffersDependencies(FacadePreloader);
 	}
@@ -93,10 +94,130 @@ namespace PCGExSortPoints
 			return false;
 		}
 
-		PointDataFacade->GetOut()->GetMutablePoints().Sort([&](const FPCGPoint& A, const FPCGPoint& B) { return Sorter->Sort(A, B); });
+		const int32 NumPoints = PointDataFacade->GetNum();
+		if (NumPoints <= 1) { return true; }
+
+		Sorter->InitKeys();
+		PCGEx::ArrayOfIndices(Order, NumPoints);
+
+		// Roughly one run per worker, each extracting its own keys then sorting its slice of the permutation
+		const int32 RunSize = FMath::Max(
+			GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize(),
+			FMath::DivideAndRoundUp(NumPoints, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1));
+
+		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, SortRunsTask)
+
+		SortRunsTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->Runs = Loops;
+			};
+
+		SortRunsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->MergeRuns();
+			};
+
+		SortRunsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				PCGExSorting::PointSorter<false>* RunSorter = This->Sorter.Get();
+				RunSorter->ExtractKeys(Scope);
+				Sort(This->Order.GetData() + Scope.Start, Scope.Count, [RunSorter](const int32 A, const int32 B) { return RunSorter->SortKeyed(A, B); });
+			};
+
+		SortRunsTask->StartSubLoops(NumPoints, RunSize);
+
 		return true;
 	}
 
+	void FProcessor::MergeRuns()
+	{
+		if (Runs.Num() <= 1)
+		{
+			ApplyOrder();
+			return;
+		}
+
+		if (MergeBuffer.IsEmpty()) { MergeBuffer.SetNumUninitialized(Order.Num()); }
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, MergeRunsTask)
+
+		MergeRunsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+
+				Swap(This->Order, This->MergeBuffer);
+
+				TArray<PCGExMT::FScope> MergedRuns;
+				MergedRuns.Reserve(This->Runs.Num() / 2 + 1);
+				for (int i = 0; i < This->Runs.Num(); i += 2)
+				{
+					const PCGExMT::FScope& Left = This->Runs[i];
+					const int32 Count = i + 1 < This->Runs.Num() ? Left.Count + This->Runs[i + 1].Count : Left.Count;
+					MergedRuns.Emplace(Left.Start, Count, MergedRuns.Num());
+				}
+
+				This->Runs = MoveTemp(MergedRuns);
+				This->MergeRuns();
+			};
+
+		MergeRunsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				for (int i = Scope.Start; i < Scope.End; i++) { This->MergeRunPair(i); }
+			};
+
+		MergeRunsTask->StartSubLoops(FMath::DivideAndRoundUp(Runs.Num(), 2), 1);
+	}
+
+	void FProcessor::MergeRunPair(const int32 PairIndex)
+	{
+		const PCGExMT::FScope& Left = Runs[PairIndex * 2];
+		int32* Write = MergeBuffer.GetData() + Left.Start;
+
+		if (PairIndex * 2 + 1 >= Runs.Num())
+		{
+			// Odd run out, carried over as-is
+			FMemory::Memcpy(Write, Order.GetData() + Left.Start, Left.Count * sizeof(int32));
+			return;
+		}
+
+		const PCGExMT::FScope& Right = Runs[PairIndex * 2 + 1];
+
+		int32 L = Left.Start;
+		int32 R = Right.Start;
+
+		// Left wins ties, keeping the merge stable
+		while (L < Left.End && R < Right.End) { *Write++ = Sorter->SortKeyed(Order[R], Order[L]) ? Order[R++] : Order[L++]; }
+		while (L < Left.End) { *Write++ = Order[L++]; }
+		while (R < Right.End) { *Write++ = Order[R++]; }
+	}
+
+	void FProcessor::ApplyOrder()
+	{
+		// Single gather pass; metadata entries travel with the points
+		const TArray<FPCGPoint>* InPoints = &PointDataFacade->GetIn()->GetPoints();
+		TArray<FPCGPoint>* OutPoints = &PointDataFacade->GetMutablePoints();
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ApplyOrderTask)
+
+		ApplyOrderTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, InPoints, OutPoints](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				for (int i = Scope.Start; i < Scope.End; i++) { (*OutPoints)[i] = (*InPoints)[This->Order[i]]; }
+			};
+
+		ApplyOrderTask->StartSubLoops(Order.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
 	void FProcessor::CompleteWork()
 	{
 		FPointsProcessor::CompleteWork();
@@ -5,6 +5,7 @@
 #include "PCGExMT.h"
 
 #include "Async/IAsyncTask.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "Tasks/Task.h"
 
 namespace PCGExMT
@@ -399,6 +400,7 @@ namespace PCGExMT
 		}
 		else
 		{
+			if (TryStartWorkStealing(MaxItems, SanitizedChunkSize, false)) { return; }
 			StartRanges<FScopeIterationTask>(MaxItems, SanitizedChunkSize, false);
 		}
 	}
@@ -407,6 +409,7 @@ namespace PCGExMT
 	{
 		if (!bDaisyChain)
 		{
+			if (TryStartWorkStealing(MaxItems, ChunkSize, true)) { return; }
 			StartRanges<FScopeIterationTask>(MaxItems, ChunkSize, true);
 			return;
 		}
@@ -470,6 +473,108 @@ namespace PCGExMT
 		for (int i = Scope.Start; i < Scope.End; i++) { OnIterationCallback(i, Scope); }
 	}
 
+	bool FTaskGroup::TryStartWorkStealing(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly)
+	{
+		const UPCGExGlobalSettings* GlobalSettings = GetDefault<UPCGExGlobalSettings>();
+		if (bForceSync || !GlobalSettings->bUseWorkStealingScheduler) { return false; }
+
+		if (!IsAvailable()) { return true; }
+
+		const TSharedPtr<FAsyncMultiHandle> PinnedRoot = Root.Pin();
+		if (!PinnedRoot) { return true; }
+
+		check(MaxItems > 0);
+
+		const int32 NumLoops = SubLoopScopes(Loops, MaxItems, FMath::Max(1, ChunkSize));
+
+		int32 MaxWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+		if (GlobalSettings->MaxWorkStealingWorkers > 0) { MaxWorkers = FMath::Min(MaxWorkers, GlobalSettings->MaxWorkStealingWorkers); }
+
+		NumWorkers = FMath::Min(NumLoops, FMath::Max(1, MaxWorkers));
+		WorkerRanges = MakeUnique<FWorkerRange[]>(NumWorkers);
+
+		// Evenly distribute contiguous loop ranges, idle workers will steal from the others
+		for (int32 i = 0; i < NumWorkers; i++)
+		{
+			const uint32 RangeStart = static_cast<uint32>((static_cast<int64>(NumLoops) * i) / NumWorkers);
+			const uint32 RangeEnd = static_cast<uint32>((static_cast<int64>(NumLoops) * (i + 1)) / NumWorkers);
+			WorkerRanges[i].Range.store(PCGEx::H64(RangeStart, RangeEnd), std::memory_order_release);
+		}
+
+		SetExpectedTaskCount(NumWorkers);
+		StaticCastSharedPtr<FTaskManager>(PinnedRoot)->ReserveTasks(NumWorkers);
+
+		if (OnPrepareSubLoopsCallback) { OnPrepareSubLoopsCallback(Loops); }
+
+		for (int32 i = 0; i < NumWorkers; i++)
+		{
+			PCGEX_MAKE_SHARED(Task, FWorkStealingScopeTask, i)
+			LaunchWithPreparation(Task, bPrepareOnly);
+		}
+
+		return true;
+	}
+
+	void FTaskGroup::ExecWorkStealing(const int32 WorkerIndex, const bool bPrepareOnly)
+	{
+		int32 LoopIndex = -1;
+		while (IsAvailable())
+		{
+			if (!ClaimLoopIndex(WorkerIndex, LoopIndex) && !StealLoopIndex(WorkerIndex, LoopIndex)) { return; }
+			ExecScopeIterations(Loops[LoopIndex], bPrepareOnly);
+		}
+	}
+
+	bool FTaskGroup::ClaimLoopIndex(const int32 WorkerIndex, int32& OutLoopIndex) const
+	{
+		// Owner consumes its own range from the front
+		std::atomic<uint64>& Range = WorkerRanges[WorkerIndex].Range;
+		uint64 Current = Range.load(std::memory_order_acquire);
+
+		while (true)
+		{
+			const uint32 RangeStart = PCGEx::H64A(Current);
+			const uint32 RangeEnd = PCGEx::H64B(Current);
+
+			if (RangeStart >= RangeEnd) { return false; }
+
+			if (Range.compare_exchange_weak(Current, PCGEx::H64(RangeStart + 1, RangeEnd), std::memory_order_acq_rel))
+			{
+				OutLoopIndex = static_cast<int32>(RangeStart);
+				return true;
+			}
+		}
+	}
+
+	bool FTaskGroup::StealLoopIndex(const int32 WorkerIndex, int32& OutLoopIndex) const
+	{
+		// Thieves take the back half of a busy worker' range, and make it their own.
+		// Ranges only ever shrink and stolen indices are never handed back, so a stale CAS cannot succeed.
+		for (int32 i = 1; i < NumWorkers; i++)
+		{
+			std::atomic<uint64>& Victim = WorkerRanges[(WorkerIndex + i) % NumWorkers].Range;
+			uint64 Current = Victim.load(std::memory_order_acquire);
+
+			while (true)
+			{
+				const uint32 RangeStart = PCGEx::H64A(Current);
+				const uint32 RangeEnd = PCGEx::H64B(Current);
+
+				if (RangeStart >= RangeEnd) { break; }
+
+				const uint32 Split = RangeEnd - FMath::Max<uint32>(1, (RangeEnd - RangeStart) / 2);
+				if (Victim.compare_exchange_weak(Current, PCGEx::H64(RangeStart, Split), std::memory_order_acq_rel))
+				{
+					OutLoopIndex = static_cast<int32>(Split);
+					WorkerRanges[WorkerIndex].Range.store(PCGEx::H64(Split + 1, RangeEnd), std::memory_order_release);
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
 	void FSimpleCallbackTask::ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager)
 	{
 		const TSharedPtr<FAsyncMultiHandle> PinnedParent = ParentHandle.Pin();
@@ -502,4 +607,12 @@ namespace PCGExMT
 		PCGEX_MAKE_SHARED(Task, FDaisyChainScopeIterationTask, Scope.GetNextScopeIndex())
 		Group->LaunchWithPreparation(Task, bPrepareOnly);
 	}
+
+	void FWorkStealingScopeTask::ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager)
+	{
+		const TSharedPtr<FAsyncMultiHandle> PinnedParent = ParentHandle.Pin();
+		if (!PinnedParent) { return; }
+
+		StaticCastSharedPtr<FTaskGroup>(PinnedParent)->ExecWorkStealing(TaskIndex, bPrepareOnly);
+	}
 }
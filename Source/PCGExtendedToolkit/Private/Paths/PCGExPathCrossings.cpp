@@ -440,7 +440,7 @@ namespace PCGExPathCrossings
 		PCGEx::ArrayOfIndices(Order, NumCrossings);
 		Order.Sort([&](const int32 A, const int32 B) { return Crossing->Alphas[A] < Crossing->Alphas[B]; });
 
-		const TSharedPtr<PCGExData::FUnionData> Union = MakeShared<PCGExData::FUnionData>();
+		uint64 UnionItems[2];
 		for (int i = 0; i < NumCrossings; i++)
 		{
 			uint32 PtIdx;
@@ -449,10 +449,9 @@ namespace PCGExPathCrossings
 
 			const int32 SecondIndex = PtIdx + 1 >= static_cast<uint32>(Context->MainPoints->Pairs[IOIdx]->GetNum(PCGExData::ESource::In)) ? 0 : PtIdx + 1;
 
-			Union->Reset();
-			Union->Add(IOIdx, PtIdx);
-			Union->Add(IOIdx, SecondIndex);
-			UnionBlender->SoftMergeSingle(Edge.AltStart + i + 1, Union, Context->Distances);
+			UnionItems[0] = PCGEx::H64(IOIdx, PtIdx);
+			UnionItems[1] = PCGEx::H64(IOIdx, SecondIndex);
+			UnionBlender->SoftMergeSingle(Edge.AltStart + i + 1, TConstArrayView<uint64>(UnionItems, UnionItems[0] == UnionItems[1] ? 1 : 2), Context->Distances);
 		}
 	}
 
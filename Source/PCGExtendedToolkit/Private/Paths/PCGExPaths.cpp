@@ -228,6 +228,119 @@ namespace PCGExPaths
 		GetMutable(Edge.Start) = PI;
 	}
 
+#pragma endregion
+
+#pragma region Spline Index
+
+	FSplineIndex::FSplineIndex(const TArray<FPCGSplineStruct>& InSplines)
+		: Splines(&InSplines)
+	{
+		TArray<FSplineSegmentBounds> Segments;
+		double ExtentSum = 0;
+
+		for (int i = 0; i < InSplines.Num(); i++)
+		{
+			const FPCGSplineStruct& Spline = InSplines[i];
+			const FTransform& SplineTransform = Spline.GetTransform();
+			const TArray<FInterpCurvePoint<FVector>>& Points = Spline.SplineCurves.Position.Points;
+
+			const int32 NumPoints = Points.Num();
+			const int32 NumSegments = Spline.GetNumberOfSplineSegments();
+
+			if (NumPoints == 0 || NumSegments == 0)
+			{
+				// Degenerate spline, the solve will always land on the same location
+				const FVector Location = Spline.GetLocationAtSplineInputKey(0, ESplineCoordinateSpace::World);
+				Segments.Emplace(FBox(Location, Location).ExpandBy(1), i, 0);
+				continue;
+			}
+
+			for (int s = 0; s < NumSegments; s++)
+			{
+				const FInterpCurvePoint<FVector>& A = Points[s];
+				const FInterpCurvePoint<FVector>& B = Points[(s + 1) % NumPoints];
+
+				// Hermite to bezier control points; the curve is contained in their convex hull
+				FBox LocalBox(ForceInit);
+				LocalBox += A.OutVal;
+				LocalBox += A.OutVal + A.LeaveTangent / 3;
+				LocalBox += B.OutVal - B.ArriveTangent / 3;
+				LocalBox += B.OutVal;
+
+				const FBox WorldBox = LocalBox.TransformBy(SplineTransform).ExpandBy(1); // Slack for evaluation precision
+				ExtentSum += WorldBox.GetExtent().GetMax();
+				Segments.Emplace(WorldBox, i, s);
+			}
+		}
+
+		if (Segments.IsEmpty()) { return; }
+
+		for (const FSplineSegmentBounds& Segment : Segments) { Bounds += Segment.Bounds.GetBox(); }
+		SeedRadius = FMath::Max(1, ExtentSum / Segments.Num());
+
+		Octree = MakeUnique<FSplineSegmentBoundsOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length() + 10);
+		for (const FSplineSegmentBounds& Segment : Segments) { Octree->AddElement(Segment); }
+	}
+
+	void FSplineIndex::FindWithinRadius(const FVector& Location, const double Radius, TArray<int32>& OutSplines) const
+	{
+		OutSplines.Reset();
+		if (!Octree) { return; }
+
+		const double RadiusSquared = Radius * Radius;
+		Octree->FindElementsWithBoundsTest(
+			FBoxCenterAndExtent(Location, FVector(Radius)), [&](const FSplineSegmentBounds& Segment)
+			{
+				if (Segment.Bounds.GetBox().ComputeSquaredDistanceToPoint(Location) > RadiusSquared) { return; }
+				OutSplines.Add(Segment.SplineIndex);
+			});
+
+		if (OutSplines.Num() <= 1) { return; }
+
+		// Keep the original spline order so results don't depend on the index
+		OutSplines.Sort();
+
+		int32 WriteIndex = 1;
+		for (int i = 1; i < OutSplines.Num(); i++) { if (OutSplines[i] != OutSplines[WriteIndex - 1]) { OutSplines[WriteIndex++] = OutSplines[i]; } }
+		OutSplines.SetNum(WriteIndex);
+	}
+
+	void FSplineIndex::FindNearestCandidates(const FVector& Location, const double Slack, TArray<int32>& OutSplines) const
+	{
+		OutSplines.Reset();
+		if (!Octree) { return; }
+
+		// Grow the search box until it hits a segment, and use the closest segment' spline as seed
+		const double MaxRadius = FMath::Sqrt(Bounds.ComputeSquaredDistanceToPoint(Location)) + Bounds.GetExtent().Length() * 2;
+		double Radius = SeedRadius;
+		double BestDistSquared = MAX_dbl;
+		int32 SeedSpline = -1;
+
+		while (SeedSpline == -1)
+		{
+			Octree->FindElementsWithBoundsTest(
+				FBoxCenterAndExtent(Location, FVector(Radius)), [&](const FSplineSegmentBounds& Segment)
+				{
+					const double DistSquared = Segment.Bounds.GetBox().ComputeSquaredDistanceToPoint(Location);
+					if (DistSquared >= BestDistSquared) { return; }
+					BestDistSquared = DistSquared;
+					SeedSpline = Segment.SplineIndex;
+				});
+
+			if (Radius > MaxRadius) { break; }
+			Radius *= 2;
+		}
+
+		if (SeedSpline == -1) { return; }
+
+		// The seed' exact distance is an upper bound of the closest distance;
+		// any spline whose segments are all farther than that can be skipped.
+		const FPCGSplineStruct& Seed = (*Splines)[SeedSpline];
+		const FVector SeedLocation = Seed.GetLocationAtSplineInputKey(Seed.FindInputKeyClosestToWorldLocation(Location), ESplineCoordinateSpace::World);
+
+		FindWithinRadius(Location, FVector::Dist(Location, SeedLocation) + Slack, OutSplines);
+	}
+
 #pragma endregion
 }
 #undef LOCTEXT_NAMESPACE
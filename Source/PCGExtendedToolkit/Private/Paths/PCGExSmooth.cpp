@@ -4,6 +4,7 @@
 #include "Paths/PCGExSmooth.h"
 
 #include "Data/Blending/PCGExMetadataBlender.h"
+#include "Data/Blending/PCGExDataBlendingProcessors.h"
 
 
 #include "Paths/Smoothing/PCGExMovingAverageSmoothing.h"
@@ -86,9 +87,6 @@ namespace PCGExSmooth
 		bClosedLoop = Context->ClosedLoop.IsClosedLoop(PointDataFacade->Source);
 		NumPoints = PointDataFacade->GetNum();
 
-		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(&Settings->BlendingSettings);
-		MetadataBlender->PrepareForData(PointDataFacade);
-
 		if (Settings->InfluenceInput == EPCGExInputValueType::Attribute)
 		{
 			Influence = PointDataFacade->GetScopedBroadcaster<double>(Settings->InfluenceAttribute);
@@ -111,6 +109,15 @@ namespace PCGExSmooth
 
 		TypedOperation = Cast<UPCGExSmoothingOperation>(PrimaryOperation);
 
+		if (!Smoothing)
+		{
+			// Constant window : linear channels can be smoothed over the whole path at once
+			if (const int32 Window = TypedOperation->GetKernelWindow(Settings->SmoothingAmountConstant); Window > 0) { InitWindowKernel(Window); }
+		}
+
+		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(WindowKernel ? &ResidualBlending : &Settings->BlendingSettings);
+		MetadataBlender->PrepareForData(PointDataFacade, PCGExData::ESource::In, true, WindowKernel ? &KernelAttributeNames : nullptr);
+
 		StartParallelLoopForPoints();
 
 		return true;
@@ -139,13 +146,130 @@ namespace PCGExSmooth
 		}
 
 		const double LocalInfluence = Influence ? Influence->Read(Index) : Settings->InfluenceConstant;
+
+		if (WindowKernel)
+		{
+			// Influence cancels out once weights are normalized, it only matters whether there is any
+			KernelMask[Index] = LocalInfluence != 0;
+			if (!bHasResidualBlending) { return; }
+		}
+
 		TypedOperation->SmoothSingle(PointIO, PtRef, LocalSmoothing, LocalInfluence, MetadataBlender.Get(), bClosedLoop);
 	}
 
 	void FProcessor::CompleteWork()
 	{
+		if (WindowKernel) { ApplyWindowKernel(); }
 		PointDataFacade->Write(AsyncManager);
 	}
+
+	void FProcessor::InitWindowKernel(const int32 Window)
+	{
+		ResidualBlending = Settings->BlendingSettings;
+		const FPCGExPropertiesBlendingDetails PropertiesBlending = Settings->BlendingSettings.GetPropertiesBlendingDetails();
+
+		// Rotation & Seed don't blend linearly and remain per-point
+#define PCGEX_KERNEL_PROPERTY(_NAME) \
+		if (FWindowKernel::Supports(PropertiesBlending._NAME##Blending)) { \
+			KernelProperties._NAME##Blending = PropertiesBlending._NAME##Blending; \
+			ResidualBlending.PropertiesOverrides.bOverride##_NAME = true; \
+			ResidualBlending.PropertiesOverrides._NAME##Blending = EPCGExDataBlendingType::None; }
+
+		PCGEX_KERNEL_PROPERTY(Density)
+		PCGEX_KERNEL_PROPERTY(BoundsMin)
+		PCGEX_KERNEL_PROPERTY(BoundsMax)
+		PCGEX_KERNEL_PROPERTY(Color)
+		PCGEX_KERNEL_PROPERTY(Position)
+		PCGEX_KERNEL_PROPERTY(Scale)
+		PCGEX_KERNEL_PROPERTY(Steepness)
+
+#undef PCGEX_KERNEL_PROPERTY
+
+		TArray<PCGEx::FAttributeIdentity> Identities;
+		PCGEx::FAttributeIdentity::Get(PointDataFacade->GetOut()->Metadata, Identities);
+		Settings->BlendingSettings.Filter(Identities);
+
+		bool bHasResidualAttributes = false;
+		for (const PCGEx::FAttributeIdentity& Identity : Identities)
+		{
+			// Same resolution as FMetadataBlender
+			const EPCGExDataBlendingType Blending = PCGEx::IsPCGExAttribute(Identity.Name) ?
+				                                        EPCGExDataBlendingType::Copy :
+				                                        PCGExDataBlending::GetBlendingType(
+					                                        Settings->BlendingSettings.AttributesOverrides.Find(Identity.Name),
+					                                        Settings->BlendingSettings.DefaultBlending, Identity);
+
+			if (!FWindowKernel::Supports(Blending, Identity.UnderlyingType))
+			{
+				bHasResidualAttributes = true;
+				continue;
+			}
+
+			KernelAttributes.Add(Identity);
+			KernelAttributesBlending.Add(Blending);
+			KernelAttributeNames.Add(Identity.Name);
+		}
+
+		bHasResidualBlending = bHasResidualAttributes || !ResidualBlending.GetPropertiesBlendingDetails().HasNoBlending();
+
+		KernelMask.Init(0, NumPoints);
+		WindowKernel = MakeShared<FWindowKernel>(NumPoints, Window, bClosedLoop);
+	}
+
+	void FProcessor::ApplyWindowKernel()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSmooth::ApplyWindowKernel);
+
+		const TArray<FPCGPoint>& InPoints = PointDataFacade->GetIn()->GetPoints();
+		TArray<FPCGPoint>& OutPoints = PointDataFacade->GetMutablePoints();
+
+		auto SmoothProperty = [&](const EPCGExDataBlendingType Blending, auto&& Get, auto&& Set)
+		{
+			if (Blending == EPCGExDataBlendingType::None) { return; }
+
+			using T = std::decay_t<decltype(Get(InPoints[0]))>;
+
+			TArray<T> Column;
+			PCGEx::InitArray(Column, NumPoints);
+			for (int i = 0; i < NumPoints; i++) { Column[i] = Get(InPoints[i]); }
+
+			TArray<T> Smoothed;
+			WindowKernel->Smooth<T>(Column, Blending, Smoothed);
+			for (int i = 0; i < NumPoints; i++) { if (KernelMask[i]) { Set(OutPoints[i], Smoothed[i]); } }
+		};
+
+		SmoothProperty(KernelProperties.DensityBlending, [](const FPCGPoint& Pt) { return Pt.Density; }, [](FPCGPoint& Pt, const float V) { Pt.Density = V; });
+		SmoothProperty(KernelProperties.BoundsMinBlending, [](const FPCGPoint& Pt) { return Pt.BoundsMin; }, [](FPCGPoint& Pt, const FVector& V) { Pt.BoundsMin = V; });
+		SmoothProperty(KernelProperties.BoundsMaxBlending, [](const FPCGPoint& Pt) { return Pt.BoundsMax; }, [](FPCGPoint& Pt, const FVector& V) { Pt.BoundsMax = V; });
+		SmoothProperty(KernelProperties.ColorBlending, [](const FPCGPoint& Pt) { return Pt.Color; }, [](FPCGPoint& Pt, const FVector4& V) { Pt.Color = V; });
+		SmoothProperty(KernelProperties.PositionBlending, [](const FPCGPoint& Pt) { return Pt.Transform.GetLocation(); }, [](FPCGPoint& Pt, const FVector& V) { Pt.Transform.SetLocation(V); });
+		SmoothProperty(KernelProperties.ScaleBlending, [](const FPCGPoint& Pt) { return Pt.Transform.GetScale3D(); }, [](FPCGPoint& Pt, const FVector& V) { Pt.Transform.SetScale3D(V); });
+		SmoothProperty(KernelProperties.SteepnessBlending, [](const FPCGPoint& Pt) { return Pt.Steepness; }, [](FPCGPoint& Pt, const float V) { Pt.Steepness = V; });
+
+		for (int i = 0; i < KernelAttributes.Num(); i++)
+		{
+			const PCGEx::FAttributeIdentity& Identity = KernelAttributes[i];
+			const EPCGExDataBlendingType Blending = KernelAttributesBlending[i];
+
+			PCGEx::ExecuteWithRightType(
+				Identity.UnderlyingType, [&](auto DummyValue)
+				{
+					using T = decltype(DummyValue);
+					if constexpr (IsWindowKernelType<T>)
+					{
+						const TSharedPtr<PCGExData::TBuffer<T>> Reader = PointDataFacade->GetReadable<T>(Identity.Name);
+						const TSharedPtr<PCGExData::TBuffer<T>> Writer = Reader ? PointDataFacade->GetWritable<T>(Identity.Name, PCGExData::EBufferInit::Inherit) : nullptr;
+						if (!Writer) { return; }
+
+						TArray<T> Smoothed;
+						WindowKernel->Smooth<T>(Reader->GetInValues()->View(), Blending, Smoothed);
+
+						PCGExData::TColumn<T>& Values = *Writer->GetOutValues();
+						for (int j = 0; j < NumPoints; j++) { if (KernelMask[j]) { Values[j] = Smoothed[j]; } }
+					}
+				});
+		}
+	}
 }
 #undef LOCTEXT_NAMESPACE
 #undef PCGEX_NAMESPACE
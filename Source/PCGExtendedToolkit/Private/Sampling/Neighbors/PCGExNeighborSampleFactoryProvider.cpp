@@ -67,7 +67,7 @@ void UPCGExNeighborSampleOperation::ProcessNode(const int32 NodeIndex) const
 	TSet<int32> VisitedNodes;
 
 	VisitedNodes.Add(NodeIndex);
-	CurrentNeighbors->Append(Node.Links);
+	CurrentNeighbors->Append(Node.Links.GetData(), Node.Links.Num());
 
 	PrepareNode(Node);
 	const FVector Origin = Cluster->GetPos(Node);
@@ -110,7 +110,7 @@ void UPCGExNeighborSampleOperation::ProcessNode(const int32 NodeIndex) const
 		NextNeighbors->Reset();
 		for (const PCGExGraph::FLink& Old : (*CurrentNeighbors))
 		{
-			const TArray<PCGExGraph::FLink>& Neighbors = Cluster->GetNode(Old.Node)->Links;
+			const PCGExGraph::FNodeLinks& Neighbors = Cluster->GetNode(Old.Node)->Links;
 			if (ValueFilters)
 			{
 				for (const PCGExGraph::FLink Next : Neighbors)
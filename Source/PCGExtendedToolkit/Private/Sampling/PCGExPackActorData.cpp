@@ -147,7 +147,7 @@ void UPCGExCustomActorDataPacker::PreloadObjectPaths(const FName& InAttributeNam
 	{
 		if (TSharedPtr<PCGExData::TBuffer<FString>> Buffer = ReadBuffers->GetBuffer<FString>(InAttributeName))
 		{
-			const TArray<FString>& Values = *Buffer->GetInValues().Get();
+			const PCGExData::TColumn<FString>& Values = *Buffer->GetInValues().Get();
 			for (const FString& V : Values) { RequiredAssetsPaths.Add(FSoftObjectPath(V)); }
 		}
 	}
@@ -156,7 +156,7 @@ void UPCGExCustomActorDataPacker::PreloadObjectPaths(const FName& InAttributeNam
 	{
 		if (TSharedPtr<PCGExData::TBuffer<FSoftObjectPath>> Buffer = ReadBuffers->GetBuffer<FSoftObjectPath>(InAttributeName))
 		{
-			const TArray<FSoftObjectPath>& Values = *Buffer->GetInValues().Get();
+			const PCGExData::TColumn<FSoftObjectPath>& Values = *Buffer->GetInValues().Get();
 			for (const FSoftObjectPath& V : Values) { RequiredAssetsPaths.Add(V); }
 		}
 	}
@@ -103,7 +103,24 @@ bool FPCGExSampleNearestPointElement::Boot(FPCGExContext* InContext) const
 	Context->TargetPoints = &Context->TargetsFacade->Source->GetIn()->GetPoints();
 	Context->NumTargets = Context->TargetPoints->Num();
 
-	Context->TargetOctree = &Context->TargetsFacade->Source->GetIn()->GetOctree();
+	{
+		// Built once and shared by all processors; reach keeps pruning exact for bounds-based distances
+		TArray<FVector> Locations;
+		TArray<double> Reach;
+		PCGEx::InitArray(Locations, Context->NumTargets);
+
+		const bool bHasReach = Settings->DistanceDetails.Target == EPCGExDistance::SphereBounds || Settings->DistanceDetails.Target == EPCGExDistance::BoxBounds;
+		if (bHasReach) { PCGEx::InitArray(Reach, Context->NumTargets); }
+
+		for (int i = 0; i < Context->NumTargets; i++)
+		{
+			const FPCGPoint& Target = *(Context->TargetPoints->GetData() + i);
+			Locations[i] = Target.Transform.GetLocation();
+			if (bHasReach) { Reach[i] = PCGExMath::GetSpatializedReach(Settings->DistanceDetails.Target, Target); }
+		}
+
+		Context->TargetIndex = MakeShared<PCGExGeo::FPointKNNIndex>(Locations, Reach);
+	}
 
 	if (Settings->WeightMode != EPCGExSampleWeightMode::Distance)
 	{
@@ -247,6 +264,13 @@ namespace PCGExSampleNearestPoints
 		bSingleSample = Settings->SampleMethod != EPCGExSampleMethod::WithinRange;
 		bSampleClosest = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget || Settings->SampleMethod == EPCGExSampleMethod::BestCandidate;
 
+		// Without a range, closest & farthest only depend on the distance extremes, which the index can find without a full scan
+		bSampleExtremes =
+			(Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget || Settings->SampleMethod == EPCGExSampleMethod::FarthestTarget) &&
+			Settings->WeightMode == EPCGExSampleWeightMode::Distance &&
+			Settings->DistanceDetails.Source != EPCGExDistance::None &&
+			Settings->DistanceDetails.Target != EPCGExDistance::None;
+
 		StartParallelLoopForPoints();
 
 		return true;
@@ -276,23 +300,24 @@ namespace PCGExSampleNearestPoints
 		TArray<PCGExNearestPoint::FSample> Samples;
 		PCGExNearestPoint::FSamplesStats Stats;
 
-		auto SampleTarget = [&](const int32 TargetPtIndex, const FPCGPoint& Target)
+		auto GetDistSquared = [&](const FPCGPoint& Target)
 		{
-			//if (Context->ValueFilterManager && !Context->ValueFilterManager->Results[PointIndex]) { return; } // TODO : Implement
-
-			double Dist = 0;
-
 			if (Settings->DistanceDetails.bOverlapIsZero)
 			{
 				bool bOverlap = false;
-				Dist = Context->DistanceDetails->GetDistSquared(Point, Target, bOverlap);
-				if (bOverlap) { Dist = 0; }
-			}
-			else
-			{
-				Dist = Context->DistanceDetails->GetDistSquared(Point, Target);
+				const double Dist = Context->DistanceDetails->GetDistSquared(Point, Target, bOverlap);
+				return bOverlap ? 0 : Dist;
 			}
 
+			return Context->DistanceDetails->GetDistSquared(Point, Target);
+		};
+
+		auto SampleTarget = [&](const int32 TargetPtIndex, const FPCGPoint& Target)
+		{
+			//if (Context->ValueFilterManager && !Context->ValueFilterManager->Results[PointIndex]) { return; } // TODO : Implement
+
+			double Dist = GetDistSquared(Target);
+
 			if (RangeMax > 0 && (Dist < RangeMin || Dist > RangeMax)) { return; }
 
 			if (Settings->WeightMode == EPCGExSampleWeightMode::Attribute) { Dist = Context->TargetWeights->Read(TargetPtIndex); }
@@ -317,16 +342,42 @@ namespace PCGExSampleNearestPoints
 			}
 		};
 
+		// Padding absorbs rounding between the index bounds and the exact distances
+		const double Slack = PCGExMath::GetSpatializedReach(Settings->DistanceDetails.Source, Point) + DBL_COMPARE_TOLERANCE;
+
 		if (RangeMax > 0)
 		{
-			const FBox Box = FBoxCenterAndExtent(Origin, FVector(FMath::Sqrt(RangeMax))).GetBox();
-			auto ProcessNeighbor = [&](const FPCGPointRef& InPointRef)
+			TArray<int32> Candidates;
+			Context->TargetIndex->FindWithinRadius(Origin, FMath::Sqrt(RangeMax) + Slack, Candidates);
+			for (const int32 TargetPtIndex : Candidates) { SampleTarget(TargetPtIndex, *(Context->TargetPoints->GetData() + TargetPtIndex)); }
+		}
+		else if (bSampleExtremes)
+		{
+			auto GetTargetDistSquared = [&](const int32 TargetPtIndex) { return GetDistSquared(*(Context->TargetPoints->GetData() + TargetPtIndex)); };
+
+			double NearestDist = 0;
+			double FarthestDist = 0;
+			const int32 Nearest = Context->TargetIndex->FindNearest(Origin, Slack, GetTargetDistSquared, NearestDist);
+			const int32 Farthest = Context->TargetIndex->FindFarthest(Origin, Slack, GetTargetDistSquared, FarthestDist);
+
+			// Feed both extremes in index order so stats & ties resolve exactly as a full scan would
+			if (Nearest != -1)
 			{
-				const ptrdiff_t TargetPtIndex = InPointRef.Point - Context->TargetPoints->GetData();
-				SampleTarget(TargetPtIndex, *(Context->TargetPoints->GetData() + TargetPtIndex));
-			};
+				const PCGExNearestPoint::FSample NearestSample(Nearest, NearestDist);
+				const PCGExNearestPoint::FSample FarthestSample(Farthest, FarthestDist);
 
-			Context->TargetOctree->FindElementsWithBoundsTest(Box, ProcessNeighbor);
+				if (Nearest == Farthest) { Stats.Update(NearestSample); }
+				else if (Nearest < Farthest)
+				{
+					Stats.Update(NearestSample);
+					Stats.Update(FarthestSample);
+				}
+				else
+				{
+					Stats.Update(FarthestSample);
+					Stats.Update(NearestSample);
+				}
+			}
 		}
 		else
 		{
@@ -3,6 +3,8 @@
 
 #include "Sampling/PCGExSampleNearestSpline.h"
 
+#include "Paths/PCGExPaths.h"
+
 
 #define LOCTEXT_NAMESPACE "PCGExSampleNearestSplineElement"
 #define PCGEX_NAMESPACE SampleNearestPolyLine
@@ -110,6 +112,8 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 		Context->Lengths[i] = Context->Targets[i]->SplineStruct.GetSplineLength();
 	}
 
+	Context->SplineIndex = MakeShared<PCGExPaths::FSplineIndex>(Context->Splines);
+
 	PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_VALIDATE_NAME)
 
 	return true;
@@ -222,6 +226,11 @@ namespace PCGExSampleNearestSpline
 		bSingleSample = Settings->SampleMethod != EPCGExSampleMethod::WithinRange;
 		bClosestSample = Settings->SampleMethod != EPCGExSampleMethod::FarthestTarget;
 
+		// Depth accounts for every target, so nothing can be skipped when it's written.
+		// Scaled ranges are only known once a spline has been sampled.
+		bPruneByRange = !Settings->bWriteDepth && !Settings->bSplineScalesRanges;
+		bPruneByNearest = !Settings->bWriteDepth && !Settings->bSampleSpecificAlpha && bSingleSample && bClosestSample;
+
 		StartParallelLoopForPoints();
 
 		return true;
@@ -284,6 +293,33 @@ namespace PCGExSampleNearestSpline
 		PCGExPolyLine::FSamplesStats Stats;
 
 		FVector Origin = Point.Transform.GetLocation();
+
+		// Narrow down targets using the spline index.
+		// Distances may be measured from the point bounds rather than its center, hence the slack.
+		TArray<int32> Candidates;
+		bool bUseCandidates = false;
+
+		if (bPruneByRange && BaseRangeMax > 0)
+		{
+			const FBoxSphereBounds PointBounds = FBoxSphereBounds(Point.GetLocalBounds().TransformBy(Point.Transform));
+			const double Slack = FVector::Dist(Origin, PointBounds.Origin) + PointBounds.SphereRadius;
+			Context->SplineIndex->FindWithinRadius(Origin, BaseRangeMax + Slack, Candidates);
+			bUseCandidates = true;
+		}
+		else if (bPruneByNearest && BaseRangeMax <= 0)
+		{
+			const FBoxSphereBounds PointBounds = FBoxSphereBounds(Point.GetLocalBounds().TransformBy(Point.Transform));
+			const double Slack = FVector::Dist(Origin, PointBounds.Origin) + PointBounds.SphereRadius;
+			Context->SplineIndex->FindNearestCandidates(Origin, Slack * 2, Candidates);
+			bUseCandidates = true;
+
+			// Single-sample bookkeeping (closed loop, inside count) is taken from the first spline processed,
+			// so it must remain the first spline whether it's a candidate or not.
+			if (Candidates.IsEmpty() || Candidates[0] != 0) { Candidates.Insert(0, 0); }
+		}
+
+		const int32 NumCandidates = bUseCandidates ? Candidates.Num() : Context->NumTargets;
+
 		auto ProcessTarget = [&](const FTransform& Transform, const double& Time, const FPCGSplineStruct& InSpline)
 		{
 			const FVector SampleLocation = Transform.GetLocation();
@@ -369,8 +405,9 @@ namespace PCGExSampleNearestSpline
 		if (!Settings->bSampleSpecificAlpha)
 		{
 			// At closest alpha
-			for (int i = 0; i < Context->NumTargets; i++)
+			for (int c = 0; c < NumCandidates; c++)
 			{
+				const int32 i = bUseCandidates ? Candidates[c] : c;
 				const FPCGSplineStruct& Line = Context->Splines[i];
 				double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
 				ProcessTarget(
@@ -381,7 +418,8 @@ namespace PCGExSampleNearestSpline
 		else
 		{
 #define PCGEX_SAMPLE_SPLINE_AT(_BODY)\
-			for (int i = 0; i < Context->NumTargets; i++){\
+			for (int c = 0; c < NumCandidates; c++){\
+			const int32 i = bUseCandidates ? Candidates[c] : c;\
 			const FPCGSplineStruct& Line = Context->Splines[i];\
 			const double SMax = Context->SegmentCounts[i];\
 			double Time = _BODY;\
@@ -44,6 +44,103 @@ void FPCGExCellSeedMutationDetails::ApplyToPoint(const PCGExTopology::FCell* InC
 
 namespace PCGExTopology
 {
+	FPlanarFaces::FPlanarFaces(const TSharedRef<PCGExCluster::FCluster>& InCluster, const TArray<FVector>& ProjectedPositions)
+	{
+		const TArray<PCGExCluster::FNode>& Nodes = *InCluster->Nodes;
+		const int32 NumNodes = Nodes.Num();
+
+		NodeOffsets.SetNumUninitialized(NumNodes + 1);
+		NodeOffsets[0] = 0;
+		for (int i = 0; i < NumNodes; i++) { NodeOffsets[i + 1] = NodeOffsets[i] + Nodes[i].Links.Num(); }
+
+		const int32 NumHalfEdges = NodeOffsets[NumNodes];
+		HalfEdges.SetNumUninitialized(NumHalfEdges);
+
+		// Each node's half-edges, counter-clockwise
+		TArray<double> Angles;
+		TArray<int32> Order;
+		for (const PCGExCluster::FNode& Node : Nodes)
+		{
+			const int32 NumLinks = Node.Links.Num();
+			const FVector& Origin = ProjectedPositions[Node.PointIndex];
+
+			Angles.SetNumUninitialized(NumLinks);
+			for (int i = 0; i < NumLinks; i++)
+			{
+				const FVector Dir = ProjectedPositions[Nodes[Node.Links[i].Node].PointIndex] - Origin;
+				Angles[i] = FMath::Atan2(Dir.Y, Dir.X);
+			}
+
+			PCGEx::ArrayOfIndices(Order, NumLinks);
+			Order.Sort([&](const int32 A, const int32 B) { return Angles[A] == Angles[B] ? A < B : Angles[A] < Angles[B]; });
+
+			FHalfEdge* NodeHalfEdges = HalfEdges.GetData() + NodeOffsets[Node.Index];
+			for (int i = 0; i < NumLinks; i++)
+			{
+				const PCGExGraph::FLink& Lk = Node.Links[Order[i]];
+				NodeHalfEdges[i] = FHalfEdge{Node.Index, Lk.Node, Lk.Edge};
+			}
+		}
+
+		// Both half-edges of an edge
+		TArray<int32> EdgeSlots;
+		EdgeSlots.Init(-1, InCluster->Edges->Num() * 2);
+		for (int i = 0; i < NumHalfEdges; i++)
+		{
+			const int32 Slot = HalfEdges[i].Edge * 2;
+			EdgeSlots[EdgeSlots[Slot] == -1 ? Slot : Slot + 1] = i;
+		}
+
+		Next.SetNumUninitialized(NumHalfEdges);
+		for (int i = 0; i < NumHalfEdges; i++)
+		{
+			const FHalfEdge& HalfEdge = HalfEdges[i];
+			const int32 Slot = HalfEdge.Edge * 2;
+			const int32 Twin = EdgeSlots[Slot] == i ? EdgeSlots[Slot + 1] : EdgeSlots[Slot];
+
+			if (Twin == -1)
+			{
+				Next[i] = -1;
+				continue;
+			}
+
+			// Twin sits among the target's half-edges; the next one clockwise is right before it
+			const int32 Start = NodeOffsets[HalfEdge.To];
+			const int32 NumLinks = NodeOffsets[HalfEdge.To + 1] - Start;
+			Next[i] = Start + (Twin - Start + NumLinks - 1) % NumLinks;
+		}
+
+		// Label orbits
+		FaceIndices.Init(-1, NumHalfEdges);
+		for (int i = 0; i < NumHalfEdges; i++)
+		{
+			if (FaceIndices[i] != -1) { continue; }
+
+			const int32 FaceIndex = Faces.Num();
+			int32 Current = i;
+			while (Current != -1 && FaceIndices[Current] == -1)
+			{
+				FaceIndices[Current] = FaceIndex;
+				Current = Next[Current];
+			}
+
+			if (Current == i)
+			{
+				Faces.Add(i);
+				continue;
+			}
+
+			// Ran into another walk; only degenerate geometry gets there
+			for (Current = i; Current != -1 && FaceIndices[Current] == FaceIndex; Current = Next[Current]) { FaceIndices[Current] = -2; }
+		}
+	}
+
+	int32 FPlanarFaces::FindHalfEdge(const int32 FromNode, const int32 Edge) const
+	{
+		for (int32 i = NodeOffsets[FromNode]; i < NodeOffsets[FromNode + 1]; i++) { if (HalfEdges[i].Edge == Edge) { return i; } }
+		return -1;
+	}
+
 	bool FHoles::Overlaps(const FGeometryScriptSimplePolygon& Polygon)
 	{
 		{
@@ -131,7 +228,8 @@ namespace PCGExTopology
 	ECellResult FCell::BuildFromCluster(
 		const PCGExGraph::FLink InSeedLink,
 		TSharedRef<PCGExCluster::FCluster> InCluster,
-		const TArray<FVector>& ProjectedPositions)
+		const TArray<FVector>& ProjectedPositions,
+		const FPlanarFaces* PlanarFaces)
 	{
 		bBuiltSuccessfully = false;
 		Data.Bounds = FBox(ForceInit);
@@ -140,8 +238,18 @@ namespace PCGExTopology
 		PCGExGraph::FLink From = InSeedLink;                                                           // From node, through edge; edge will be updated to be last traversed after.
 		PCGExGraph::FLink To = PCGExGraph::FLink(InCluster->GetEdgeOtherNode(From)->Index, Seed.Edge); // To node, through edge
 
-		const uint64 SeedHalfEdge = PCGEx::H64(From.Node, To.Node);
-		if (!Constraints->IsUniqueStartHalfEdge(SeedHalfEdge)) { return ECellResult::Duplicate; }
+		// Planar faces are walked once each, no need to track where walks started
+		int32 HalfEdge = -1;
+		if (PlanarFaces)
+		{
+			HalfEdge = PlanarFaces->FindHalfEdge(From.Node, Seed.Edge);
+			if (HalfEdge == -1) { return ECellResult::MalformedCluster; }
+		}
+		else
+		{
+			const uint64 SeedHalfEdge = PCGEx::H64(From.Node, To.Node);
+			if (!Constraints->IsUniqueStartHalfEdge(SeedHalfEdge)) { return ECellResult::Duplicate; }
+		}
 
 		const FVector SeedRP = InCluster->GetPos(From.Node);
 
@@ -208,25 +316,34 @@ namespace PCGExTopology
 			}
 
 			// Seek next best candidate
-			const FVector PP = ProjectedPositions[Current->PointIndex];
-			const FVector GuideDir = (PP - ProjectedPositions[InCluster->GetNode(From.Node)->PointIndex]).GetSafeNormal();
+			if (PlanarFaces)
+			{
+				HalfEdge = PlanarFaces->Next[HalfEdge];
+				From = To;
+				To = HalfEdge == -1 ? PCGExGraph::FLink(-1, -1) : PCGExGraph::FLink(PlanarFaces->HalfEdges[HalfEdge].To, PlanarFaces->HalfEdges[HalfEdge].Edge);
+			}
+			else
+			{
+				const FVector PP = ProjectedPositions[Current->PointIndex];
+				const FVector GuideDir = (PP - ProjectedPositions[InCluster->GetNode(From.Node)->PointIndex]).GetSafeNormal();
 
-			From = To;
-			To = PCGExGraph::FLink(-1, -1);
+				From = To;
+				To = PCGExGraph::FLink(-1, -1);
 
-			double BestAngle = MAX_dbl;
-			for (const PCGExGraph::FLink Lk : Current->Links)
-			{
-				const int32 NeighborIndex = Lk.Node;
+				double BestAngle = MAX_dbl;
+				for (const PCGExGraph::FLink Lk : Current->Links)
+				{
+					const int32 NeighborIndex = Lk.Node;
 
-				if (Lk.Edge == LockedEdge) { continue; }
+					if (Lk.Edge == LockedEdge) { continue; }
 
-				const FVector OtherDir = (PP - ProjectedPositions[InCluster->GetNode(NeighborIndex)->PointIndex]).GetSafeNormal();
+					const FVector OtherDir = (PP - ProjectedPositions[InCluster->GetNode(NeighborIndex)->PointIndex]).GetSafeNormal();
 
-				if (const double Angle = PCGExMath::GetRadiansBetweenVectors(OtherDir, GuideDir); Angle < BestAngle)
-				{
-					BestAngle = Angle;
-					To = Lk;
+					if (const double Angle = PCGExMath::GetRadiansBetweenVectors(OtherDir, GuideDir); Angle < BestAngle)
+					{
+						BestAngle = Angle;
+						To = Lk;
+					}
 				}
 			}
 
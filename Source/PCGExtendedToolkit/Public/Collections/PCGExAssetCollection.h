@@ -1,4 +1,4 @@
-// Copyright 2024 Timothé Lapetite and contributors
+﻿// Copyright 2024 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -350,6 +350,10 @@ namespace PCGExAssetCollection
 		TArray<int32> Order;
 		TArray<const FPCGExAssetCollectionEntry*> Entries;
 
+		// Alias table, indexed like Order -- see Compile
+		TArray<double> AliasProbabilities;
+		TArray<int32> Aliases;
+
 		FCategory()
 		{
 		}
@@ -404,10 +408,9 @@ namespace PCGExAssetCollection
 
 		FORCEINLINE int32 GetPickRandomWeighted(const int32 Seed) const
 		{
-			const int32 Threshold = FRandomStream(Seed).RandRange(0, WeightSum - 1);
-			int32 Pick = 0;
-			while (Pick < Weights.Num() && Weights[Pick] < Threshold) { Pick++; }
-			return Indices[Order[Pick]];
+			FRandomStream RandomStream(Seed);
+			const int32 Slot = RandomStream.RandRange(0, Order.Num() - 1);
+			return Indices[Order[RandomStream.FRand() < AliasProbabilities[Slot] ? Slot : Aliases[Slot]]];
 		}
 
 
@@ -423,6 +426,8 @@ namespace PCGExAssetCollection
 			Indices.Shrink();
 			Weights.Shrink();
 			Order.Shrink();
+			AliasProbabilities.Shrink();
+			Aliases.Shrink();
 		}
 
 		void RegisterEntry(const int32 Index, const FPCGExAssetCollectionEntry* InEntry);
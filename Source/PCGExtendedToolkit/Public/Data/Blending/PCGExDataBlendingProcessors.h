@@ -159,7 +159,7 @@ namespace PCGExDataBlending
 #undef PCGEX_BLEND_CASE
 	}
 
-	static TSharedPtr<FDataBlendingProcessorBase> CreateProcessorWithDefaults(const EPCGExDataBlendingType DefaultType, const PCGEx::FAttributeIdentity& Identity)
+	static EPCGExDataBlendingType GetBlendingTypeWithDefaults(const EPCGExDataBlendingType DefaultType, const PCGEx::FAttributeIdentity& Identity)
 	{
 		EPCGExDataBlendingTypeDefault GlobalDefaultType = EPCGExDataBlendingTypeDefault::Default;
 
@@ -172,13 +172,24 @@ namespace PCGExDataBlending
 		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_DEF_SET)
 		}
 
-		if (GlobalDefaultType == EPCGExDataBlendingTypeDefault::Default) { return CreateProcessor(DefaultType, Identity); }
-		return CreateProcessor(static_cast<EPCGExDataBlendingType>(static_cast<uint8>(GlobalDefaultType)), Identity);
+		if (GlobalDefaultType == EPCGExDataBlendingTypeDefault::Default) { return DefaultType; }
+		return static_cast<EPCGExDataBlendingType>(static_cast<uint8>(GlobalDefaultType));
 
 #undef PCGEX_DEF_SET
 #undef PCGEX_BLEND_CASE
 	}
 
+	static TSharedPtr<FDataBlendingProcessorBase> CreateProcessorWithDefaults(const EPCGExDataBlendingType DefaultType, const PCGEx::FAttributeIdentity& Identity)
+	{
+		return CreateProcessor(GetBlendingTypeWithDefaults(DefaultType, Identity), Identity);
+	}
+
+	/** Blending that CreateProcessor would resolve to for a given attribute */
+	static EPCGExDataBlendingType GetBlendingType(const EPCGExDataBlendingType* Type, const EPCGExDataBlendingType DefaultType, const PCGEx::FAttributeIdentity& Identity)
+	{
+		return Type ? *Type : GetBlendingTypeWithDefaults(DefaultType, Identity);
+	}
+
 
 	static TSharedPtr<FDataBlendingProcessorBase> CreateProcessor(const EPCGExDataBlendingType* Type, const EPCGExDataBlendingType DefaultType, const PCGEx::FAttributeIdentity& Identity)
 	{
@@ -361,7 +361,7 @@ namespace PCGEx
 		 * Build and validate a property/attribute accessor for the selected
 		 * @param Dump
 		 */
-		void Fetch(TArray<T>& Dump, const PCGExMT::FScope& Scope)
+		void Fetch(TArrayView<T> Dump, const PCGExMT::FScope& Scope)
 		{
 			check(bValid)
 			check(Dump.Num() == PointIO->GetNum(PCGExData::ESource::In)) // Dump target should be initialized at full length before using Fetch
@@ -374,14 +374,7 @@ namespace PCGEx
 					Attribute->GetTypeId(), [&](auto DummyValue)
 					{
 						using RawT = decltype(DummyValue);
-
-						TArray<RawT> RawValues;
-						PCGEx::InitArray(RawValues, Scope.Count);
-
-						TArrayView<RawT> RawView(RawValues);
-						InternalAccessor->GetRange(RawView, Scope.Start, *PointIO->GetInKeys().Get(), EPCGAttributeAccessorFlags::AllowBroadcast);
-
-						for (int i = 0; i < Scope.Count; i++) { Dump[Scope.Start + i] = Convert(RawValues[i]); }
+						ReadAttributeRange<RawT>(Dump, Scope.Start, Scope.Count);
 					});
 			}
 			else if (InternalSelector.GetSelection() == EPCGAttributePropertySelection::PointProperty)
@@ -413,59 +406,48 @@ namespace PCGEx
 		 */
 		void GrabAndDump(TArray<T>& Dump, const bool bCaptureMinMax, T& OutMin, T& OutMax)
 		{
+			PCGEx::InitArray(Dump, PointIO->GetNum(PCGExData::ESource::In));
+			GrabAndDump(MakeArrayView(Dump), bCaptureMinMax, OutMin, OutMax);
+		}
+
+		/**
+		 * Same as above, into a destination that's already sized to the number of input points
+		 * @param Dump
+		 * @param bCaptureMinMax
+		 * @param OutMin
+		 * @param OutMax
+		 */
+		void GrabAndDump(TArrayView<T> Dump, const bool bCaptureMinMax, T& OutMin, T& OutMax)
+		{
+			const int32 NumPoints = PointIO->GetNum(PCGExData::ESource::In);
+			check(Dump.Num() == NumPoints)
+
 			if (!bValid)
 			{
-				int32 NumPoints = PointIO->GetNum(PCGExData::ESource::In);
-				PCGEx::InitArray(Dump, NumPoints);
 				for (int i = 0; i < NumPoints; i++) { Dump[i] = T{}; }
 				return;
 			}
 
 			const UPCGPointData* InData = PointIO->GetIn();
 
-			int32 NumPoints = PointIO->GetNum(PCGExData::ESource::In);
-			PCGEx::InitArray(Dump, NumPoints);
-
 			if (InternalSelector.GetSelection() == EPCGAttributePropertySelection::Attribute)
 			{
 				PCGEx::ExecuteWithRightType(
 					Attribute->GetTypeId(), [&](auto DummyValue)
 					{
 						using RawT = decltype(DummyValue);
-						TArray<RawT> RawValues;
-
-						PCGEx::InitArray(RawValues, NumPoints);
-
-						TArrayView<RawT> View(RawValues);
-						InternalAccessor->GetRange(View, 0, *PointIO->GetInKeys().Get(), EPCGAttributeAccessorFlags::AllowBroadcast);
-
-						if (bCaptureMinMax)
-						{
-							for (int i = 0; i < NumPoints; i++)
-							{
-								T V = Convert(RawValues[i]);
-								OutMin = PCGExMath::Min(V, OutMin);
-								OutMax = PCGExMath::Max(V, OutMax);
-								Dump[i] = V;
-							}
-						}
-						else
-						{
-							for (int i = 0; i < NumPoints; i++) { Dump[i] = Convert(RawValues[i]); }
-						}
-
-						RawValues.Empty();
+						ReadAttributeRange<RawT>(Dump, 0, NumPoints);
 					});
+
+				if (bCaptureMinMax) { PCGExMath::MinMaxRange(Dump.GetData(), NumPoints, OutMin, OutMax); }
 			}
 			else if (InternalSelector.GetSelection() == EPCGAttributePropertySelection::PointProperty)
 			{
 				const TArray<FPCGPoint>& InPoints = InData->GetPoints();
 
 #define PCGEX_GET_BY_ACCESSOR(_ENUM, _ACCESSOR) case _ENUM:\
-				if (bCaptureMinMax) { for (int i = 0; i < NumPoints; i++) {\
-						T V = Convert(InPoints[i]._ACCESSOR); OutMin = PCGExMath::Min(V, OutMin); OutMax = PCGExMath::Max(V, OutMax); Dump[i] = V;\
-					} } else { for (int i = 0; i < NumPoints; i++) { Dump[i] = Convert(InPoints[i]._ACCESSOR); } } break;
-
+				for (int i = 0; i < NumPoints; i++) { Dump[i] = Convert(InPoints[i]._ACCESSOR); }\
+				if (bCaptureMinMax) { PCGExMath::MinMaxRange(Dump.GetData(), NumPoints, OutMin, OutMax); } break;
 				switch (InternalSelector.GetPointProperty()) { PCGEX_FOREACH_POINTPROPERTY(PCGEX_GET_BY_ACCESSOR) }
 #undef PCGEX_GET_BY_ACCESSOR
 			}
@@ -540,12 +522,7 @@ namespace PCGEx
 			if (!bMinMaxDirty) { return; }
 			ResetMinMax();
 			bMinMaxDirty = false;
-			for (int i = 0; i < Values.Num(); i++)
-			{
-				T V = Values[i];
-				Min = PCGExMath::Min(V, Min);
-				Max = PCGExMath::Max(V, Max);
-			}
+			PCGExMath::MinMaxRange(Values.GetData(), Values.Num(), Min, Max);
 		}
 
 		void Normalize()
@@ -609,11 +586,45 @@ namespace PCGEx
 	protected:
 		virtual void ResetMinMax() { PCGExMath::TypeMinMax(Min, Max); }
 
+		static constexpr int32 ConversionChunkSize = 1024;
+
+		/**
+		 * Read attribute values straight into the destination.
+		 * Matching types are read in place; otherwise values are converted through a small reusable chunk.
+		 */
+		template <typename RawT>
+		void ReadAttributeRange(TArrayView<T> Dump, const int32 Start, const int32 Count)
+		{
+			if (Count <= 0) { return; }
+
+			if constexpr (std::is_same_v<RawT, T>)
+			{
+				TArrayView<T> View(Dump.GetData() + Start, Count);
+				InternalAccessor->GetRange(View, Start, *PointIO->GetInKeys().Get(), EPCGAttributeAccessorFlags::AllowBroadcast);
+			}
+			else
+			{
+				TArray<RawT> Chunk;
+				PCGEx::InitArray(Chunk, FMath::Min(Count, ConversionChunkSize));
+
+				for (int32 ChunkStart = 0; ChunkStart < Count; ChunkStart += ConversionChunkSize)
+				{
+					const int32 ChunkCount = FMath::Min(ConversionChunkSize, Count - ChunkStart);
+
+					TArrayView<RawT> View(Chunk.GetData(), ChunkCount);
+					InternalAccessor->GetRange(View, Start + ChunkStart, *PointIO->GetInKeys().Get(), EPCGAttributeAccessorFlags::AllowBroadcast);
+
+					T* Out = Dump.GetData() + Start + ChunkStart;
+					for (int i = 0; i < ChunkCount; i++) { Out[i] = Convert(Chunk[i]); }
+				}
+			}
+		}
+
 #pragma region Conversions
 
 #pragma region Convert from bool
 
-		FORCEINLINE virtual T Convert(const bool Value) const
+		FORCEINLINE T Convert(const bool Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -646,7 +657,7 @@ namespace PCGEx
 
 #pragma region Convert from Integer32
 
-		FORCEINLINE virtual T Convert(const int32 Value) const
+		FORCEINLINE T Convert(const int32 Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -667,7 +678,7 @@ namespace PCGEx
 
 #pragma region Convert from Integer64
 
-		FORCEINLINE virtual T Convert(const int64 Value) const
+		FORCEINLINE T Convert(const int64 Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -688,7 +699,7 @@ namespace PCGEx
 
 #pragma region Convert from Float
 
-		FORCEINLINE virtual T Convert(const float Value) const
+		FORCEINLINE T Convert(const float Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -709,7 +720,7 @@ namespace PCGEx
 
 #pragma region Convert from Double
 
-		FORCEINLINE virtual T Convert(const double Value) const
+		FORCEINLINE T Convert(const double Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -730,7 +741,7 @@ namespace PCGEx
 
 #pragma region Convert from FVector2D
 
-		FORCEINLINE virtual T Convert(const FVector2D& Value) const
+		FORCEINLINE T Convert(const FVector2D& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -782,7 +793,7 @@ namespace PCGEx
 
 #pragma region Convert from FVector
 
-		FORCEINLINE virtual T Convert(const FVector& Value) const
+		FORCEINLINE T Convert(const FVector& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -836,7 +847,7 @@ namespace PCGEx
 
 #pragma region Convert from FVector4
 
-		FORCEINLINE virtual T Convert(const FVector4& Value) const
+		FORCEINLINE T Convert(const FVector4& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -891,7 +902,7 @@ namespace PCGEx
 
 #pragma region Convert from FQuat
 
-		FORCEINLINE virtual T Convert(const FQuat& Value) const
+		FORCEINLINE T Convert(const FQuat& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -951,7 +962,7 @@ namespace PCGEx
 
 #pragma region Convert from FRotator
 
-		FORCEINLINE virtual T Convert(const FRotator& Value) const
+		FORCEINLINE T Convert(const FRotator& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -1004,7 +1015,7 @@ namespace PCGEx
 
 #pragma region Convert from FTransform
 
-		FORCEINLINE virtual T Convert(const FTransform& Value) const
+		FORCEINLINE T Convert(const FTransform& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -1038,7 +1049,7 @@ namespace PCGEx
 
 #pragma region Convert from FString
 
-		FORCEINLINE virtual T Convert(const FString& Value) const
+		FORCEINLINE T Convert(const FString& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -1053,7 +1064,7 @@ namespace PCGEx
 
 #pragma region Convert from FName
 
-		FORCEINLINE virtual T Convert(const FName& Value) const
+		FORCEINLINE T Convert(const FName& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -1068,7 +1079,7 @@ namespace PCGEx
 
 #pragma region Convert from FSoftClassPath
 
-		FORCEINLINE virtual T Convert(const FSoftClassPath& Value) const
+		FORCEINLINE T Convert(const FSoftClassPath& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -1083,7 +1094,7 @@ namespace PCGEx
 
 #pragma region Convert from FSoftObjectPath
 
-		FORCEINLINE virtual T Convert(const FSoftObjectPath& Value) const
+		FORCEINLINE T Convert(const FSoftObjectPath& Value) const
 		{
 			if constexpr (std::is_same_v<T, decltype(Value)>) { return Value; }
 
@@ -77,6 +77,109 @@ namespace PCGExData
 		return PCGEx::H64(GetTypeHash(FullName), static_cast<int32>(Type));
 	};
 
+	/**
+	 * Per-facade memory pool buffer columns are carved from.
+	 * Released columns are recycled by size, and all blocks are freed in one go once the last column referencing the arena is gone.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FBufferArena final
+	{
+		mutable FRWLock ArenaLock;
+
+		TArray<void*> Blocks;
+		TMap<int64, TArray<void*>> Released;
+
+		uint8* Cursor = nullptr;
+		int64 Remaining = 0;
+		int64 NextBlockSize = 0;
+		int32 NumLiveAllocations = 0;
+
+		void FreeBlocks();
+
+	public:
+		static constexpr int64 Alignment = 16;
+		static constexpr int64 MaxBlockSize = 1 << 20;
+
+		FBufferArena() = default;
+		~FBufferArena();
+
+		FBufferArena(const FBufferArena&) = delete;
+		FBufferArena& operator=(const FBufferArena&) = delete;
+
+		void* Allocate(const int64 InSize);
+		void Release(void* InMemory, const int64 InSize);
+
+		/** Give all blocks back to the allocator. No-op while columns are still alive. */
+		void Reset();
+	};
+
+	/**
+	 * Fixed-length value column backing a buffer.
+	 * Trivially copyable values live in the owning facade's arena, anything else in a TArray of its own.
+	 */
+	template <typename T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TColumn final
+	{
+		TSharedPtr<FBufferArena> Arena;
+		TArray<T> OwnedValues;
+
+		T* Data = nullptr;
+		int32 NumValues = 0;
+
+	public:
+		static constexpr bool bArenaBacked = std::is_trivially_copyable_v<T> && alignof(T) <= FBufferArena::Alignment;
+
+		/** Values are left uninitialized for trivially copyable types */
+		TColumn(const TSharedPtr<FBufferArena>& InArena, const int32 InNum)
+			: NumValues(InNum)
+		{
+			if constexpr (bArenaBacked)
+			{
+				if (InArena && InNum > 0)
+				{
+					Arena = InArena;
+					Data = static_cast<T*>(Arena->Allocate(static_cast<int64>(sizeof(T)) * InNum));
+					return;
+				}
+			}
+
+			PCGEx::InitArray(OwnedValues, InNum);
+			Data = OwnedValues.GetData();
+		}
+
+		TColumn(const TColumn&) = delete;
+		TColumn& operator=(const TColumn&) = delete;
+
+		~TColumn()
+		{
+			if (Arena) { Arena->Release(Data, static_cast<int64>(sizeof(T)) * NumValues); }
+		}
+
+		FORCEINLINE T* GetData() { return Data; }
+		FORCEINLINE const T* GetData() const { return Data; }
+		FORCEINLINE int32 Num() const { return NumValues; }
+
+		FORCEINLINE T& operator[](const int32 Index) { return Data[Index]; }
+		FORCEINLINE const T& operator[](const int32 Index) const { return Data[Index]; }
+
+		FORCEINLINE T* begin() { return Data; }
+		FORCEINLINE T* end() { return Data + NumValues; }
+		FORCEINLINE const T* begin() const { return Data; }
+		FORCEINLINE const T* end() const { return Data + NumValues; }
+
+		FORCEINLINE TArrayView<T> View() { return TArrayView<T>(Data, NumValues); }
+		FORCEINLINE TConstArrayView<T> View() const { return TConstArrayView<T>(Data, NumValues); }
+
+		void Init(const T& Value) { for (int i = 0; i < NumValues; i++) { Data[i] = Value; } }
+
+		/** Copy values over from a column of the same length, a plain memcpy for trivially copyable types */
+		void CopyFrom(const TColumn& Other)
+		{
+			check(Other.NumValues == NumValues)
+			if constexpr (std::is_trivially_copyable_v<T>) { FMemory::Memcpy(Data, Other.Data, static_cast<int64>(sizeof(T)) * NumValues); }
+			else { for (int i = 0; i < NumValues; i++) { Data[i] = Other.Data[i]; } }
+		}
+	};
+
 	class /*PCGEXTENDEDTOOLKIT_API*/ FBufferBase : public TSharedFromThis<FBufferBase>
 	{
 		friend class FFacade;
@@ -155,8 +258,10 @@ namespace PCGExData
 		TUniquePtr<FPCGAttributeAccessor<T>> OutAccessor;
 		FPCGMetadataAttribute<T>* TypedOutAttribute = nullptr;
 
-		TSharedPtr<TArray<T>> InValues;
-		TSharedPtr<TArray<T>> OutValues;
+		TSharedPtr<FBufferArena> Arena;
+
+		TSharedPtr<TColumn<T>> InValues;
+		TSharedPtr<TColumn<T>> OutValues;
 
 	public:
 		T Min = T{};
@@ -166,8 +271,8 @@ namespace PCGExData
 
 		virtual bool IsScoped() override { return bScopedBuffer || InternalBroadcaster; }
 
-		TBuffer(const TSharedRef<FPointIO>& InSource, const FName InFullName):
-			FBufferBase(InSource, InFullName)
+		TBuffer(const TSharedRef<FPointIO>& InSource, const FName InFullName, const TSharedPtr<FBufferArena>& InArena = nullptr):
+			FBufferBase(InSource, InFullName), Arena(InArena)
 		{
 			SetType(PCGEx::GetMetadataType<T>());
 		}
@@ -180,8 +285,8 @@ namespace PCGExData
 		virtual bool IsWritable() override { return OutValues ? true : false; }
 		virtual bool IsReadable() override { return InValues ? true : false; }
 
-		TSharedPtr<TArray<T>> GetInValues() { return InValues; }
-		TSharedPtr<TArray<T>> GetOutValues() { return OutValues; }
+		TSharedPtr<TColumn<T>> GetInValues() { return InValues; }
+		TSharedPtr<TColumn<T>> GetOutValues() { return OutValues; }
 		const FPCGMetadataAttribute<T>* GetTypedInAttribute() const { return TypedInAttribute; }
 		FPCGMetadataAttribute<T>* GetTypedOutAttribute() { return TypedOutAttribute; }
 
@@ -202,8 +307,7 @@ namespace PCGExData
 			const int32 NumPoints = InPts.Num();
 			InPoints = MakeArrayView(InPts.GetData(), NumPoints);
 
-			InValues = MakeShared<TArray<T>>();
-			PCGEx::InitArray(InValues, NumPoints);
+			InValues = MakeShared<TColumn<T>>(Arena, NumPoints);
 
 			InAttribute = Attribute;
 			TypedInAttribute = Attribute ? static_cast<const FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
@@ -211,16 +315,55 @@ namespace PCGExData
 			bScopedBuffer = bScoped;
 		}
 
-		void PrepareWriteInternal(FPCGMetadataAttributeBase* Attribute, const T& InDefaultValue, const EBufferInit Init)
+		/**
+		 * Whether fully-read input values can stand in for the inherited output values.
+		 * That's only true when the output is a pristine 1:1 child of the input : same points, same entries, no local values.
+		 */
+		bool CanInheritFromInValues() const
 		{
-			if (OutValues) { return; }
+			if (!InValues || InValues == OutValues || !bReadComplete || bScopedBuffer || !InAccessor.IsValid()) { return false; }
+
+			const UPCGPointData* InData = Source->GetIn();
+			const UPCGPointData* OutData = Source->GetOut();
+			if (!InData || !OutData || !TypedOutAttribute) { return false; }
+
+			if (InData != OutData)
+			{
+				if (OutData->Metadata->GetParent() != InData->Metadata) { return false; }
+				if (TypedOutAttribute->GetParent() != TypedInAttribute || TypedOutAttribute->GetNumberOfEntries() != 0) { return false; }
+			}
+
+			const TArray<FPCGPoint>& InPts = InData->GetPoints();
+			const TArray<FPCGPoint>& OutPts = OutData->GetPoints();
+			if (InPts.Num() != OutPts.Num() || InValues->Num() != OutPts.Num()) { return false; }
+
+			for (int i = 0; i < OutPts.Num(); i++) { if (InPts[i].MetadataEntry != OutPts[i].MetadataEntry) { return false; } }
+
+			return true;
+		}
+
+		/** Returns true if output values have been seeded from the input values */
+		bool PrepareWriteInternal(FPCGMetadataAttributeBase* Attribute, const T& InDefaultValue, const EBufferInit Init)
+		{
+			if (OutValues) { return false; }
 
 			TArray<FPCGPoint>& OutPts = Source->GetMutablePoints();
 			const int32 NumPoints = OutPts.Num();
 			OutPoints = MakeArrayView(OutPts.GetData(), NumPoints);
 
-			OutValues = MakeShared<TArray<T>>();
-			OutValues->Init(InDefaultValue, NumPoints);
+			bool bSeeded = false;
+			OutValues = MakeShared<TColumn<T>>(Arena, NumPoints);
+
+			if (Init == EBufferInit::Inherit && CanInheritFromInValues())
+			{
+				// Leverage prefetched data
+				OutValues->CopyFrom(*InValues);
+				bSeeded = true;
+			}
+			else
+			{
+				OutValues->Init(InDefaultValue);
+			}
 
 			if (Attribute)
 			{
@@ -230,6 +373,8 @@ namespace PCGExData
 
 			OutAttribute = Attribute;
 			TypedOutAttribute = Attribute ? static_cast<FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
+
+			return bSeeded;
 		}
 
 	public:
@@ -289,7 +434,7 @@ namespace PCGExData
 
 			if (!bScopedBuffer && !bReadComplete)
 			{
-				TArrayView<T> InRange = MakeArrayView(InValues->GetData(), InValues->Num());
+				TArrayView<T> InRange = InValues->View();
 				InAccessor->GetRange(InRange, 0, *Source->GetInKeys());
 				bReadComplete = true;
 			}
@@ -307,7 +452,7 @@ namespace PCGExData
 				if (bScopedBuffer && !bScoped)
 				{
 					// Un-scoping reader.
-					InternalBroadcaster->GrabAndDump(*InValues, bCaptureMinMax, Min, Max);
+					InternalBroadcaster->GrabAndDump(InValues->View(), bCaptureMinMax, Min, Max);
 					bReadComplete = true;
 					bScopedBuffer = false;
 					InternalBroadcaster.Reset();
@@ -337,7 +482,7 @@ namespace PCGExData
 
 			if (!bScopedBuffer && !bReadComplete)
 			{
-				InternalBroadcaster->GrabAndDump(*InValues, bCaptureMinMax, Min, Max);
+				InternalBroadcaster->GrabAndDump(InValues->View(), bCaptureMinMax, Min, Max);
 				bReadComplete = true;
 				InternalBroadcaster.Reset();
 			}
@@ -365,7 +510,7 @@ namespace PCGExData
 				return false;
 			}
 
-			PrepareWriteInternal(TypedOutAttribute, DefaultValue, Init);
+			const bool bSeeded = PrepareWriteInternal(TypedOutAttribute, DefaultValue, Init);
 
 			const int32 ExistingEntryCount = TypedOutAttribute->GetNumberOfEntries();
 			const bool bHasIn = Source->GetIn() ? true : false;
@@ -373,45 +518,13 @@ namespace PCGExData
 			auto GrabExistingValues = [&]()
 			{
 				TUniquePtr<FPCGAttributeAccessorKeysPoints> TempOutKeys = MakeUnique<FPCGAttributeAccessorKeysPoints>(MakeArrayView(Source->GetMutablePoints().GetData(), OutValues->Num()));
-				TArrayView<T> OutRange = MakeArrayView(OutValues->GetData(), OutValues->Num());
+				TArrayView<T> OutRange = OutValues->View();
 				OutAccessor->GetRange(OutRange, 0, *TempOutKeys.Get());
 			};
 
 			if (Init == EBufferInit::Inherit)
 			{
-				GrabExistingValues();
-				/*
-				if (!bHasIn && ExistingEntryCount != 0) { GrabExistingValues(); }
-				else if (bHasIn)
-				{
-					if (InValues && bReadComplete)
-					{
-						// Leverage prefetched data					
-						int32 NumToCopy = FMath::Min(InValues->Num(), OutValues->Num());
-						if constexpr (std::is_trivial_v<T>)
-						{
-							FMemory::Memcpy(OutValues->GetData(), InValues->GetData(), NumToCopy * sizeof(T));
-						}
-						else
-						{
-							for (int32 i = 0; i < NumToCopy; i++) { *(OutValues->GetData() + i) = *(InValues->GetData() + i); }
-						}
-					}
-					else
-					{
-						UPCGMetadata* InMetadata = Source->GetIn()->Metadata;
-
-						// 'template' spec required for clang on mac, not sure why.
-						// ReSharper disable once CppRedundantTemplateKeyword
-						if (const FPCGMetadataAttribute<T>* TempInAttribute = InMetadata->template GetConstTypedAttribute<T>(FullName))
-						{
-							TUniquePtr<FPCGAttributeAccessor<T>> TempInAccessor = MakeUnique<FPCGAttributeAccessor<T>>(TempInAttribute, InMetadata);
-							TArrayView<T> OutRange = MakeArrayView(OutValues->GetData(), FMath::Min(Source->GetNum(), OutValues->Num()));
-							TempInAccessor->GetRange(OutRange, 0, *Source->GetInKeys());
-						}
-					}
-				}
-				*/
+				if (!bSeeded) { GrabExistingValues(); }
 			}
 			else if (!bHasIn && ExistingEntryCount != 0) { GrabExistingValues(); }
 
@@ -460,7 +573,7 @@ namespace PCGExData
 		virtual void Fetch(const PCGExMT::FScope& Scope) override
 		{
 			if (!IsScoped() || bReadComplete) { return; }
-			if (InternalBroadcaster) { InternalBroadcaster->Fetch(*InValues, Scope); }
+			if (InternalBroadcaster) { InternalBroadcaster->Fetch(InValues->View(), Scope); }
 			if (InAccessor.IsValid())
 			{
 				TArrayView<T> ReadRange = MakeArrayView(InValues->GetData() + Scope.Start, Scope.Count);
@@ -492,6 +605,7 @@ namespace PCGExData
 		TArray<TSharedPtr<FBufferBase>> Buffers;
 		TMap<uint64, TSharedPtr<FBufferBase>> BufferMap;
 		TSharedPtr<PCGExGeo::FPointBoxCloud> Cloud;
+		TSharedPtr<FBufferArena> Arena;
 
 		bool bSupportsScopedGet = false;
 
@@ -502,7 +616,7 @@ namespace PCGExData
 		TSharedPtr<FBufferBase> FindBuffer(const uint64 UID);
 
 		explicit FFacade(const TSharedRef<FPointIO>& InSource):
-			Source(InSource)
+			Source(InSource), Arena(MakeShared<FBufferArena>())
 		{
 			PCGEX_LOG_CTR(FFacade)
 		}
@@ -544,7 +658,7 @@ namespace PCGExData
 				NewBuffer = FindBufferUnsafe<T>(FullName);
 				if (NewBuffer) { return NewBuffer; }
 
-				NewBuffer = MakeShared<TBuffer<T>>(Source, FullName);
+				NewBuffer = MakeShared<TBuffer<T>>(Source, FullName, Arena);
 				NewBuffer->BufferIndex = Buffers.Num();
 
 				Buffers.Add(StaticCastSharedPtr<FBufferBase>(NewBuffer));
@@ -712,6 +826,7 @@ namespace PCGExData
 			FWriteScopeLock WriteScopeLock(BufferLock);
 			Buffers.Empty();
 			BufferMap.Empty();
+			Arena->Reset();
 		}
 
 		void Write(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
@@ -842,62 +957,66 @@ namespace PCGExData
 
 #pragma region Compound
 
-	class /*PCGEXTENDEDTOOLKIT_API*/ FUnionData : public TSharedFromThis<FUnionData>
+	/**
+	 * Computes blending weights for a list of packed (IOIndex, PointIndex) union items.
+	 * Items whose IOIndex isn't part of SourcesIdx are skipped.
+	 */
+	void ComputeUnionWeights(
+		const TConstArrayView<uint64> Items,
+		const TArray<TSharedPtr<FFacade>>& Sources,
+		const TMap<uint32, int32>& SourcesIdx,
+		const FPCGPoint& Target,
+		const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails,
+		TArray<int32>& OutIOIdx,
+		TArray<int32>& OutPointsIdx,
+		TArray<double>& OutWeights);
+
+	/** Returns true if both sorted item lists share at least one IOIndex */
+	bool UnionIOIndexOverlap(const TConstArrayView<uint64> A, const TConstArrayView<uint64> B);
+
+	/**
+	 * Flat union membership storage.
+	 * Entry i owns Items[Offsets[i] .. Offsets[i+1]), each item being a packed H64(IOIndex, ItemIndex).
+	 * Items are sorted & unique within an entry, which also groups them by IOIndex.
+	 *
+	 * Built in two passes over the same contributions: BeginCount/Count, then BeginFill/Fill/EndFill.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FUnionMetadata : public TSharedFromThis<FUnionMetadata>
 	{
 	protected:
-		mutable FRWLock UnionLock;
+		TArray<int32> Cursors;
 
 	public:
-		//int32 Index = 0;
-		TSet<int32> IOIndices;
-		TSet<uint64> ItemHashSet;
+		TArray<int32> Offsets;
+		TArray<uint64> Items;
+		bool bIsAbstract = false;
 
-		FUnionData()
+		FUnionMetadata()
 		{
 		}
 
-		~FUnionData() = default;
-
-		int32 Num() const { return ItemHashSet.Num(); }
-
-		void ComputeWeights(
-			const TArray<TSharedPtr<FFacade>>& Sources,
-			const TMap<uint32, int32>& SourcesIdx,
-			const FPCGPoint& Target,
-			const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails,
-			TArray<int32>& OutIOIdx,
-			TArray<int32>& OutPointsIdx,
-			TArray<double>& OutWeights) const;
-
-		uint64 Add(const int32 IOIndex, const int32 PointIndex);
-
-		void Reset()
+		~FUnionMetadata()
 		{
-			IOIndices.Reset();
-			ItemHashSet.Reset();
 		}
-	};
 
-	class /*PCGEXTENDEDTOOLKIT_API*/ FUnionMetadata : public TSharedFromThis<FUnionMetadata>
-	{
-	public:
-		TArray<TSharedPtr<FUnionData>> Entries;
-		bool bIsAbstract = false;
+		int32 Num() const { return FMath::Max(0, Offsets.Num() - 1); }
 
-		FUnionMetadata() { Entries.Empty(); }
+		FORCEINLINE int32 NumItems(const int32 Index) const { return Offsets[Index + 1] - Offsets[Index]; }
 
-		~FUnionMetadata()
+		FORCEINLINE TConstArrayView<uint64> Get(const int32 Index) const
 		{
+			if (Index < 0 || Index >= Num()) { return TConstArrayView<uint64>(); }
+			return TConstArrayView<uint64>(Items.GetData() + Offsets[Index], Offsets[Index + 1] - Offsets[Index]);
 		}
 
-		int32 Num() const { return Entries.Num(); }
-
-		TSharedPtr<FUnionData> NewEntry(const int32 IOIndex, const int32 ItemIndex);
+		void BeginCount(const int32 NumEntries);
+		FORCEINLINE void Count(const int32 Index) { Offsets[Index + 1]++; }
 
-		uint64 Append(const int32 Index, const int32 IOIndex, const int32 ItemIndex);
-		bool IOIndexOverlap(const int32 InIdx, const TSet<int32>& InIndices);
+		void BeginFill();
+		FORCEINLINE void Fill(const int32 Index, const int32 IOIndex, const int32 ItemIndex) { Items[Cursors[Index]++] = PCGEx::H64(IOIndex, ItemIndex); }
+		void EndFill();
 
-		FORCEINLINE TSharedPtr<FUnionData> Get(const int32 Index) const { return Entries.IsValidIndex(Index) ? Entries[Index] : nullptr; }
+		FORCEINLINE bool IOIndexOverlap(const int32 InIdx, const TConstArrayView<uint64> InItems) const { return UnionIOIndexOverlap(Get(InIdx), InItems); }
 	};
 
 #pragma endregion
@@ -128,6 +128,21 @@ namespace PCGExFilterGroup
 			for (const TSharedPtr<PCGExPointFilter::FFilter>& Filter : ManagedFilters) { if (!Filter->Test(Edge)) { return bInvert; } }
 			return !bInvert;
 		}
+
+		virtual void TestScope(const PCGExMT::FScope& Scope, TBitArray<>& OutResults) const override
+		{
+			OutResults.Init(true, Scope.Count);
+
+			TBitArray<> FilterResults;
+			for (const TSharedPtr<PCGExPointFilter::FFilter>& Filter : ManagedFilters)
+			{
+				Filter->TestScope(Scope, FilterResults);
+				PCGExPointFilter::AndScope(OutResults, FilterResults);
+				if (PCGExPointFilter::IsUniformScope(OutResults, false)) { break; }
+			}
+
+			if (bInvert) { PCGExPointFilter::InvertScope(OutResults); }
+		}
 	};
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FFilterGroupOR final : public FFilterGroup
@@ -155,5 +170,20 @@ namespace PCGExFilterGroup
 			for (const TSharedPtr<PCGExPointFilter::FFilter>& Filter : ManagedFilters) { if (Filter->Test(Edge)) { return !bInvert; } }
 			return bInvert;
 		}
+
+		virtual void TestScope(const PCGExMT::FScope& Scope, TBitArray<>& OutResults) const override
+		{
+			OutResults.Init(false, Scope.Count);
+
+			TBitArray<> FilterResults;
+			for (const TSharedPtr<PCGExPointFilter::FFilter>& Filter : ManagedFilters)
+			{
+				Filter->TestScope(Scope, FilterResults);
+				PCGExPointFilter::OrScope(OutResults, FilterResults);
+				if (PCGExPointFilter::IsUniformScope(OutResults, true)) { break; }
+			}
+
+			if (bInvert) { PCGExPointFilter::InvertScope(OutResults); }
+		}
 	};
 }
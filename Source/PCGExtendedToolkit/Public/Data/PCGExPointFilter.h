@@ -68,6 +68,88 @@ namespace PCGExPointFilter
 	const FName OutputInsideFiltersLabel = FName("Inside");
 	const FName OutputOutsideFiltersLabel = FName("Outside");
 
+#pragma region Scope results
+
+	// Scope results are bit arrays where bit i holds the result for index Scope.Start + i.
+	// They're combined a word at a time; trailing bits of the last word are kept cleared, as TBitArray expects.
+
+	FORCEINLINE static uint32 GetTailMask(const int32 NumBits)
+	{
+		const int32 Tail = NumBits & 31;
+		return Tail ? (1u << Tail) - 1 : ~0u;
+	}
+
+	/** Packs Predicate(Index) for every index of the scope, 32 results at a time. */
+	template <typename FPredicate>
+	FORCEINLINE static void PackScope(const PCGExMT::FScope& Scope, TBitArray<>& OutResults, FPredicate&& Predicate)
+	{
+		OutResults.SetNumUninitialized(Scope.Count);
+		uint32* Words = OutResults.GetData();
+
+		const int32 NumWords = FMath::DivideAndRoundUp(Scope.Count, 32);
+		for (int32 w = 0; w < NumWords; w++)
+		{
+			const int32 Base = Scope.Start + w * 32;
+			const int32 NumBits = FMath::Min(32, Scope.End - Base);
+
+			uint32 Word = 0;
+			for (int32 b = 0; b < NumBits; b++) { Word |= static_cast<uint32>(Predicate(Base + b)) << b; }
+			Words[w] = Word;
+		}
+	}
+
+	FORCEINLINE static void AndScope(TBitArray<>& InOutResults, const TBitArray<>& InResults)
+	{
+		check(InOutResults.Num() == InResults.Num())
+		uint32* Words = InOutResults.GetData();
+		const uint32* Other = InResults.GetData();
+		const int32 NumWords = FMath::DivideAndRoundUp(InOutResults.Num(), 32);
+		for (int32 w = 0; w < NumWords; w++) { Words[w] &= Other[w]; }
+	}
+
+	FORCEINLINE static void OrScope(TBitArray<>& InOutResults, const TBitArray<>& InResults)
+	{
+		check(InOutResults.Num() == InResults.Num())
+		uint32* Words = InOutResults.GetData();
+		const uint32* Other = InResults.GetData();
+		const int32 NumWords = FMath::DivideAndRoundUp(InOutResults.Num(), 32);
+		for (int32 w = 0; w < NumWords; w++) { Words[w] |= Other[w]; }
+	}
+
+	FORCEINLINE static void InvertScope(TBitArray<>& InOutResults)
+	{
+		const int32 NumWords = FMath::DivideAndRoundUp(InOutResults.Num(), 32);
+		if (!NumWords) { return; }
+
+		uint32* Words = InOutResults.GetData();
+		for (int32 w = 0; w < NumWords; w++) { Words[w] = ~Words[w]; }
+		Words[NumWords - 1] &= GetTailMask(InOutResults.Num());
+	}
+
+	/** Whether every result of the scope equals bValue */
+	FORCEINLINE static bool IsUniformScope(const TBitArray<>& InResults, const bool bValue)
+	{
+		const int32 NumWords = FMath::DivideAndRoundUp(InResults.Num(), 32);
+		if (!NumWords) { return true; }
+
+		const uint32* Words = InResults.GetData();
+		const uint32 Expected = bValue ? ~0u : 0u;
+		for (int32 w = 0; w < NumWords - 1; w++) { if (Words[w] != Expected) { return false; } }
+
+		const uint32 TailMask = GetTailMask(InResults.Num());
+		return (Words[NumWords - 1] & TailMask) == (Expected & TailMask);
+	}
+
+	/** Writes scope results to OutResults[Scope.Start .. Scope.End) */
+	FORCEINLINE static void UnpackScope(const PCGExMT::FScope& Scope, const TBitArray<>& InResults, TArray<int8>& OutResults)
+	{
+		const uint32* Words = InResults.GetData();
+		int8* Out = OutResults.GetData() + Scope.Start;
+		for (int32 i = 0; i < Scope.Count; i++) { Out[i] = static_cast<int8>((Words[i >> 5] >> (i & 31)) & 1); }
+	}
+
+#pragma endregion
+
 	class /*PCGEXTENDEDTOOLKIT_API*/ FFilter
 	{
 	public:
@@ -97,6 +179,12 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExCluster::FNode& Node) const;
 		virtual bool Test(const PCGExGraph::FEdge& Edge) const;
 
+		/**
+		 * Tests every index of the scope at once. Defaults to per-index Test;
+		 * filters with a typed kernel override this to get rid of the per-point virtual call.
+		 */
+		virtual void TestScope(const PCGExMT::FScope& Scope, TBitArray<>& OutResults) const;
+
 		virtual ~FFilter() = default;
 	};
 
@@ -134,6 +222,9 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExCluster::FNode& Node);
 		virtual bool Test(const PCGExGraph::FEdge& Edge);
 
+		/** Same as Test(Index) over a whole scope, writing to OutResults[Scope.Start .. Scope.End) */
+		virtual void TestScope(const PCGExMT::FScope& Scope, TArray<int8>& OutResults);
+
 		virtual ~FManager()
 		{
 		}
@@ -38,7 +38,7 @@ protected:
 namespace PCGExPointIOMerger
 {
 	template <typename T>
-	static void ScopeMerge(const PCGExMT::FScope& Scope, const PCGEx::FAttributeIdentity& Identity, const TSharedPtr<PCGExData::FPointIO>& SourceIO, TArray<T>& OutValues)
+	static void ScopeMerge(const PCGExMT::FScope& Scope, const PCGEx::FAttributeIdentity& Identity, const TSharedPtr<PCGExData::FPointIO>& SourceIO, PCGExData::TColumn<T>& OutValues)
 	{
 		UPCGMetadata* InMetadata = SourceIO->GetIn()->Metadata;
 
@@ -78,7 +78,7 @@ namespace PCGExPointIOMerger
 			const TSharedPtr<PCGExData::FPointIO>& InPointIO,
 			const PCGExMT::FScope& InScope,
 			const PCGEx::FAttributeIdentity& InIdentity,
-			const TSharedPtr<TArray<T>>& InOutValues)
+			const TSharedPtr<PCGExData::TColumn<T>>& InOutValues)
 			: FTask(),
 			  PointIO(InPointIO),
 			  Scope(InScope),
@@ -90,7 +90,7 @@ namespace PCGExPointIOMerger
 		const TSharedPtr<PCGExData::FPointIO> PointIO;
 		const PCGExMT::FScope Scope;
 		const PCGEx::FAttributeIdentity Identity;
-		TSharedPtr<TArray<T>> OutValues;
+		TSharedPtr<PCGExData::TColumn<T>> OutValues;
 
 		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override
 		{
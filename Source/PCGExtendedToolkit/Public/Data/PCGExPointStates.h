@@ -93,12 +93,13 @@ namespace PCGExPointStates
 	class /*PCGEXTENDEDTOOLKIT_API*/ FStateManager final : public PCGExPointFilter::FManager
 	{
 		TArray<TSharedPtr<FState>> States;
-		TSharedPtr<TArray<int64>> FlagsCache;
+		TSharedPtr<PCGExData::TColumn<int64>> FlagsCache;
 
 	public:
-		explicit FStateManager(const TSharedPtr<TArray<int64>>& InFlags, const TSharedRef<PCGExData::FFacade>& InPointDataFacade);
+		explicit FStateManager(const TSharedPtr<PCGExData::TColumn<int64>>& InFlags, const TSharedRef<PCGExData::FFacade>& InPointDataFacade);
 
 		virtual bool Test(const int32 Index) override;
+		virtual void TestScope(const PCGExMT::FScope& Scope, TArray<int8>& OutResults) override;
 
 	protected:
 		virtual void PostInitFilter(FPCGExContext* InContext, const TSharedPtr<PCGExPointFilter::FFilter>& InFilter) override;
@@ -0,0 +1,164 @@
+﻿// Copyright 2024 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGEx.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Octree summarizing a point set by center of mass, for Barnes-Hut style far-field approximations.
+	 * Meant to be rebuilt whenever positions change, then queried concurrently.
+	 * Cells are stored flat; an internal cell's eight children are contiguous, and each cell covers
+	 * a contiguous range of the reordered positions.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FBarnesHutTree : public TSharedFromThis<FBarnesHutTree>
+	{
+		static constexpr int32 LeafSize = 8;
+		static constexpr int32 MaxDepth = 20;
+
+		struct FCell
+		{
+			FVector Center = FVector::ZeroVector;
+			double Extent = 0; // Half size of the cube
+			FVector CenterOfMass = FVector::ZeroVector;
+			int32 Start = 0;
+			int32 End = 0;
+			int32 FirstChild = -1;
+		};
+
+	protected:
+		TArray<FCell> Cells;
+		TArray<int32> Order;
+		TArray<int32> Scratch;
+		TArray<FVector> Positions; // In tree order
+
+	public:
+		FBarnesHutTree() = default;
+
+		void Rebuild(const TConstArrayView<FVector> InPositions)
+		{
+			const int32 NumPositions = InPositions.Num();
+
+			Cells.Reset();
+			PCGEx::ArrayOfIndices(Order, NumPositions);
+			Scratch.SetNumUninitialized(NumPositions);
+
+			if (!NumPositions)
+			{
+				Positions.Reset();
+				return;
+			}
+
+			FBox Bounds = FBox(ForceInit);
+			for (const FVector& Position : InPositions) { Bounds += Position; }
+
+			FCell& Root = Cells.Emplace_GetRef();
+			Root.Center = Bounds.GetCenter();
+			Root.Extent = Bounds.GetExtent().GetMax() + UE_KINDA_SMALL_NUMBER;
+			Root.End = NumPositions;
+
+			BuildCell(InPositions, 0, 0);
+
+			Positions.SetNumUninitialized(NumPositions);
+			for (int i = 0; i < NumPositions; i++) { Positions[i] = InPositions[Order[i]]; }
+		}
+
+		/**
+		 * Visits every position but Self, either individually or lumped into a distant cell's center of mass.
+		 * A cell is lumped when its size over its distance to Location is below Theta, and Location lies outside of it.
+		 * @param Visit Called with (Position, Mass)
+		 */
+		template <typename FVisitFunc>
+		void ForEachBody(const FVector& Location, const int32 Self, const double Theta, FVisitFunc&& Visit) const
+		{
+			if (Cells.IsEmpty()) { return; }
+
+			const double ThetaSquared = Theta * Theta;
+
+			// Each level replaces one cell with eight
+			int32 Stack[7 * MaxDepth + 8];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const FCell& Cell = Cells[Stack[--StackSize]];
+
+				if (Cell.Start >= Cell.End) { continue; }
+
+				if (Cell.FirstChild == -1)
+				{
+					for (int32 i = Cell.Start; i < Cell.End; i++) { if (Order[i] != Self) { Visit(Positions[i], 1.0); } }
+					continue;
+				}
+
+				const FVector Offset = Cell.CenterOfMass - Location;
+				const bool bOutside = FMath::Abs(Location.X - Cell.Center.X) > Cell.Extent ||
+					FMath::Abs(Location.Y - Cell.Center.Y) > Cell.Extent ||
+					FMath::Abs(Location.Z - Cell.Center.Z) > Cell.Extent;
+
+				if (bOutside && FMath::Square(2 * Cell.Extent) < ThetaSquared * Offset.SizeSquared())
+				{
+					Visit(Cell.CenterOfMass, static_cast<double>(Cell.End - Cell.Start));
+					continue;
+				}
+
+				for (int32 c = 0; c < 8; c++) { Stack[StackSize++] = Cell.FirstChild + c; }
+			}
+		}
+
+	protected:
+		void BuildCell(const TConstArrayView<FVector>& InPositions, const int32 CellIndex, const int32 Depth)
+		{
+			// Cells may reallocate while children are added, work from a copy
+			FCell Cell = Cells[CellIndex];
+
+			FVector Sum = FVector::ZeroVector;
+			for (int32 i = Cell.Start; i < Cell.End; i++) { Sum += InPositions[Order[i]]; }
+			Cell.CenterOfMass = Sum / static_cast<double>(Cell.End - Cell.Start);
+
+			if (Cell.End - Cell.Start <= LeafSize || Depth >= MaxDepth)
+			{
+				Cells[CellIndex] = Cell;
+				return;
+			}
+
+			// Counting sort of the cell's range into octants
+			int32 Counts[8] = {};
+			for (int32 i = Cell.Start; i < Cell.End; i++) { Counts[GetOctant(Cell, InPositions[Order[i]])]++; }
+
+			int32 Offsets[8];
+			Offsets[0] = Cell.Start;
+			for (int32 c = 1; c < 8; c++) { Offsets[c] = Offsets[c - 1] + Counts[c - 1]; }
+
+			for (int32 i = Cell.Start; i < Cell.End; i++) { Scratch[Offsets[GetOctant(Cell, InPositions[Order[i]])]++] = Order[i]; }
+			FMemory::Memcpy(Order.GetData() + Cell.Start, Scratch.GetData() + Cell.Start, (Cell.End - Cell.Start) * sizeof(int32));
+
+			Cell.FirstChild = Cells.Num();
+			Cells[CellIndex] = Cell;
+
+			const double ChildExtent = Cell.Extent * 0.5;
+			int32 ChildStart = Cell.Start;
+
+			for (int32 c = 0; c < 8; c++)
+			{
+				FCell& Child = Cells.Emplace_GetRef();
+				Child.Center = Cell.Center + FVector(c & 1 ? ChildExtent : -ChildExtent, c & 2 ? ChildExtent : -ChildExtent, c & 4 ? ChildExtent : -ChildExtent);
+				Child.Extent = ChildExtent;
+				Child.Start = ChildStart;
+				Child.End = ChildStart + Counts[c];
+				ChildStart = Child.End;
+			}
+
+			for (int32 c = 0; c < 8; c++) { if (Counts[c]) { BuildCell(InPositions, Cell.FirstChild + c, Depth + 1); } }
+		}
+
+		FORCEINLINE static int32 GetOctant(const FCell& Cell, const FVector& Position)
+		{
+			return (Position.X >= Cell.Center.X ? 1 : 0) | (Position.Y >= Cell.Center.Y ? 2 : 0) | (Position.Z >= Cell.Center.Z ? 4 : 0);
+		}
+	};
+}
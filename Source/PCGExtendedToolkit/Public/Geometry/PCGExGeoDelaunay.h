@@ -7,9 +7,52 @@
 #include "PCGExGeo.h"
 #include "CompGeom/Delaunay2.h"
 #include "CompGeom/Delaunay3.h"
+#include "CompGeom/ExactPredicates.h"
+#include "Algo/BinarySearch.h"
 
 namespace PCGExGeo
 {
+	/**
+	 * Removes duplicates in place, keeping the first occurrence of each value where it was.
+	 * Delaunay edges are collected flat, then made unique in one pass; order matches what a TSet would have iterated.
+	 */
+	static void StableUnique(TArray<uint64>& InValues)
+	{
+		const int32 NumValues = InValues.Num();
+		if (NumValues <= 1) { return; }
+
+		TArray<int32> Order;
+		PCGEx::ArrayOfIndices(Order, NumValues);
+		Order.Sort([&](const int32 A, const int32 B) { return InValues[A] == InValues[B] ? A < B : InValues[A] < InValues[B]; });
+
+		TBitArray<> Keep;
+		Keep.Init(false, NumValues);
+		Keep[Order[0]] = true;
+		for (int i = 1; i < NumValues; i++) { if (InValues[Order[i]] != InValues[Order[i - 1]]) { Keep[Order[i]] = true; } }
+
+		int32 WriteIndex = 0;
+		for (int i = 0; i < NumValues; i++) { if (Keep[i]) { InValues[WriteIndex++] = InValues[i]; } }
+		InValues.SetNum(WriteIndex);
+	}
+
+	/** Removes every value found in InRemoved, preserving the order of what's left. */
+	static void RemoveValues(TArray<uint64>& InValues, const TArray<uint64>& InRemoved)
+	{
+		if (InRemoved.IsEmpty()) { return; }
+
+		TArray<uint64> SortedRemoved = InRemoved;
+		SortedRemoved.Sort();
+
+		int32 WriteIndex = 0;
+		for (int i = 0; i < InValues.Num(); i++)
+		{
+			const uint64 Value = InValues[i];
+			if (Algo::BinarySearch(SortedRemoved, Value) != INDEX_NONE) { continue; }
+			InValues[WriteIndex++] = Value;
+		}
+		InValues.SetNum(WriteIndex);
+	}
+
 	struct FDelaunaySite2
 	{
 		int32 Vtx[3];
@@ -48,8 +91,8 @@ namespace PCGExGeo
 	public:
 		TArray<FDelaunaySite2> Sites;
 
-		TSet<uint64> DelaunayEdges;
-		TSet<int32> DelaunayHull;
+		TArray<uint64> DelaunayEdges; // Unique, in first-occurrence order
+		TBitArray<> DelaunayHull;     // One bit per position
 		bool IsValid = false;
 
 		mutable FRWLock ProcessLock;
@@ -101,64 +144,123 @@ namespace PCGExGeo
 			}
 
 			const int32 NumSites = Triangles.Num();
-			const int32 NumReserve = NumSites * 3;
 
-			DelaunayEdges.Reserve(NumReserve);
+			// Every triangle writes its own slots; shared edges are collapsed afterward
+			DelaunayEdges.SetNumUninitialized(NumSites * 3);
+			DelaunayHull.Init(false, Positions.Num());
 
 			PCGEx::InitArray(Sites, NumSites);
 
 			for (int i = 0; i < NumSites; i++)
 			{
 				FDelaunaySite2& Site = Sites[i] = FDelaunaySite2(Triangles[i], Adjacencies[i], i);
+				uint64* SiteEdges = DelaunayEdges.GetData() + i * 3;
+
+				SiteEdges[0] = PCGEx::H64U(Site.Vtx[0], Site.Vtx[1]);
+				SiteEdges[1] = PCGEx::H64U(Site.Vtx[0], Site.Vtx[2]);
+				SiteEdges[2] = PCGEx::H64U(Site.Vtx[1], Site.Vtx[2]);
 
 				for (int a = 0; a < 3; a++)
 				{
-					for (int b = a + 1; b < 3; b++)
-					{
-						const uint64 H = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]);
-						DelaunayEdges.Add(H);
+					if (Site.Neighbors[a] != -1) { continue; }
 
-						if (Site.Neighbors[b] == -1)
-						{
-							Site.bOnHull = true;
-							DelaunayHull.Add(Site.Vtx[b]);
-						}
-					}
-
-					if (Site.Neighbors[a] == -1)
-					{
-						Site.bOnHull = true;
-						DelaunayHull.Add(Site.Vtx[a]);
-						//DelaunayHull.Add(Site.Vtx[PCGExMath::Tile(a + 1, 0, 2)]);
-					}
+					Site.bOnHull = true;
+					DelaunayHull[Site.Vtx[a]] = true;
 				}
 			}
 
+			StableUnique(DelaunayEdges);
+
 			Triangles.Empty();
 			Adjacencies.Empty();
 
 			return IsValid;
 		}
 
-		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
+		/**
+		 * Whether the current triangles are still a Delaunay triangulation of the given (moved) positions:
+		 * every point is used, no triangle flipped, every shared edge passes the empty circle test and the hull is still convex.
+		 */
+		bool IsStillDelaunay(const TArray<FVector2D>& Positions2D) const
 		{
-			uint64 Edge;
+			if (!IsValid || Sites.IsEmpty() || DelaunayHull.Num() != Positions2D.Num()) { return false; }
+
+			using namespace UE::Geometry;
+
+			const FVector2D* P = Positions2D.GetData();
+			const double Sign = FMath::Sign(ExactPredicates::Orient2(P[Sites[0].Vtx[0]], P[Sites[0].Vtx[1]], P[Sites[0].Vtx[2]]));
+			if (Sign == 0) { return false; }
+
+			TArray<int32> HullNext;
+			HullNext.Init(-1, Positions2D.Num());
+
+			TBitArray<> Used;
+			Used.Init(false, Positions2D.Num());
+
 			for (const FDelaunaySite2& Site : Sites)
 			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
+				const FVector2D& A = P[Site.Vtx[0]];
+				const FVector2D& B = P[Site.Vtx[1]];
+				const FVector2D& C = P[Site.Vtx[2]];
+
+				if (ExactPredicates::Orient2(A, B, C) * Sign <= 0) { return false; }
+
+				for (int i = 0; i < 3; i++)
+				{
+					Used[Site.Vtx[i]] = true;
+
+					// Triangle-order edges not shared with a neighbor are hull edges
+					const uint64 Edge = PCGEx::H64U(Site.Vtx[i], Site.Vtx[(i + 1) % 3]);
+					bool bShared = false;
+					for (const int32 Neighbor : Site.Neighbors) { if (Neighbor != -1 && Sites[Neighbor].ContainsEdge(Edge)) { bShared = true; } }
+					if (!bShared) { HullNext[Site.Vtx[i]] = Site.Vtx[(i + 1) % 3]; }
+
+					// Each shared edge is tested once, from its lowest site
+					const int32 Neighbor = Site.Neighbors[i];
+					if (Neighbor == -1 || Neighbor < Site.Id) { continue; }
+
+					for (const int32 Opposite : Sites[Neighbor].Vtx)
+					{
+						if (Opposite == Site.Vtx[0] || Opposite == Site.Vtx[1] || Opposite == Site.Vtx[2]) { continue; }
+						if (ExactPredicates::InCircle2(A, B, C, P[Opposite]) * Sign > 0) { return false; }
+					}
+				}
+			}
+
+			for (int i = 0; i < HullNext.Num(); i++)
+			{
+				if (!Used[i]) { return false; }
+
+				const int32 Next = HullNext[i];
+				if (Next == -1) { continue; }
+
+				const int32 NextNext = HullNext[Next];
+				if (NextNext == -1 || ExactPredicates::Orient2(P[i], P[Next], P[NextNext]) * Sign <= 0) { return false; }
 			}
+
+			return true;
+		}
+
+		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
+		{
+			TArray<uint64> LongestEdges;
+			GetLongestEdges(Positions, LongestEdges);
+			RemoveValues(DelaunayEdges, LongestEdges);
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
 		{
-			uint64 Edge;
-			for (const FDelaunaySite2& Site : Sites)
-			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
-				LongestEdges.Add(Edge);
-			}
+			TArray<uint64> SiteLongestEdges;
+			GetLongestEdges(Positions, SiteLongestEdges);
+			RemoveValues(DelaunayEdges, SiteLongestEdges);
+			LongestEdges.Append(SiteLongestEdges);
+		}
+
+		void GetLongestEdges(const TArrayView<FVector>& Positions, TArray<uint64>& OutEdges) const
+		{
+			OutEdges.SetNumUninitialized(Sites.Num());
+			for (int i = 0; i < Sites.Num(); i++) { GetLongestEdge(Positions, Sites[i].Vtx, OutEdges[i]); }
+			StableUnique(OutEdges);
 		}
 
 		void GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites)
@@ -213,6 +315,7 @@ namespace PCGExGeo
 		int32 Vtx[4];
 		int32 Id = -1;
 		int8 bOnHull = 0;
+		int8 Orientation = 0; // Sign of Orient3 over the sorted vertices, at build time
 
 		explicit FDelaunaySite3(const FIntVector4& InVtx, const int32 InId = -1) : Id(InId)
 		{
@@ -236,9 +339,11 @@ namespace PCGExGeo
 	public:
 		TArray<FDelaunaySite3> Sites;
 
-		TSet<uint64> DelaunayEdges;
-		TSet<int32> DelaunayHull;
+		TArray<uint64> DelaunayEdges; // Unique, in first-occurrence order
+		TBitArray<> DelaunayHull;     // One bit per position
 		TMap<uint32, uint64> Adjacency;
+		TArray<int32> FaceNeighbors; // Site across each face, 4 per site; only built when checking validity
+		TArray<int32> NeighborFaces; // Same face, as indexed by the site across
 
 		bool IsValid = false;
 
@@ -258,6 +363,8 @@ namespace PCGExGeo
 			Sites.Empty();
 			DelaunayEdges.Empty();
 			DelaunayHull.Empty();
+			FaceNeighbors.Empty();
+			NeighborFaces.Empty();
 
 			IsValid = false;
 		}
@@ -281,13 +388,15 @@ namespace PCGExGeo
 			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
 
 			const int32 NumSites = Tetrahedra.Num();
-			const int32 NumReserve = NumSites * 3;
 
-			DelaunayEdges.Reserve(NumReserve);
+			// Every tetrahedron writes its own slots; shared edges are collapsed afterward
+			DelaunayEdges.SetNumUninitialized(NumSites * 6);
+			DelaunayHull.Init(false, Positions.Num());
 
-			TSet<uint32> FacesUsage;
+			// Face hash in the high bits, owning site & face in the low bits
+			TArray<uint64> FacesUsage;
 			if constexpr (bComputeAdjacency) { Adjacency.Reserve(NumSites * 4); }
-			if constexpr (bComputeHull) { FacesUsage.Reserve(NumSites); }
+			if constexpr (bComputeHull) { FacesUsage.SetNumUninitialized(NumSites * 4); }
 
 			//PCGEx::InitArray(Sites, NumSites);
 			Sites.SetNumUninitialized(NumSites);
@@ -297,41 +406,24 @@ namespace PCGExGeo
 				Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
 				FDelaunaySite3& Site = Sites[i];
 
+				// Sorting the vertices scrambles the winding, so each site keeps track of its own
+				Site.Orientation = static_cast<int8>(FMath::Sign(UE::Geometry::ExactPredicates::Orient3(
+					Positions[Site.Vtx[0]], Positions[Site.Vtx[1]], Positions[Site.Vtx[2]], Positions[Site.Vtx[3]])));
+
+				uint64* SiteEdges = DelaunayEdges.GetData() + i * 6;
 				for (int a = 0; a < 4; a++)
 				{
-					for (int b = a + 1; b < 4; b++)
-					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
-					}
+					for (int b = a + 1; b < 4; b++) { *SiteEdges++ = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]); }
 				}
 
 				if constexpr (bComputeHull || bComputeAdjacency) { Site.ComputeFaces(); }
 
-				if constexpr (bComputeHull && bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet) { FacesUsage.Remove(FH); }
-
-						if (const uint64* AH = Adjacency.Find(FH)) { Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH))); }
-						else { Adjacency.Add(FH, PCGEx::NH64(-1, i)); }
-					}
-				}
-				else if constexpr (bComputeHull)
+				if constexpr (bComputeHull)
 				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet) { FacesUsage.Remove(FH); }
-					}
+					for (int f = 0; f < 4; f++) { FacesUsage[i * 4 + f] = static_cast<uint64>(Site.Faces[f]) << 32 | static_cast<uint32>(i * 4 + f); }
 				}
-				else if constexpr (bComputeAdjacency)
+
+				if constexpr (bComputeAdjacency)
 				{
 					for (int f = 0; f < 4; f++)
 					{
@@ -342,18 +434,35 @@ namespace PCGExGeo
 				}
 			}
 
+			StableUnique(DelaunayEdges);
+
 			if constexpr (bComputeHull)
 			{
-				for (FDelaunaySite3& Site : Sites)
+				// Faces used an odd number of times are on the hull
+				FacesUsage.Sort();
+
+				int32 RunStart = 0;
+				while (RunStart < FacesUsage.Num())
 				{
-					for (int f = 0; f < 4; f++)
+					const uint32 FH = static_cast<uint32>(FacesUsage[RunStart] >> 32);
+
+					int32 RunEnd = RunStart + 1;
+					while (RunEnd < FacesUsage.Num() && static_cast<uint32>(FacesUsage[RunEnd] >> 32) == FH) { RunEnd++; }
+
+					if ((RunEnd - RunStart) % 2 == 1)
 					{
-						if (FacesUsage.Contains(Site.Faces[f]))
+						for (int r = RunStart; r < RunEnd; r++)
 						{
-							for (int fi = 0; fi < 3; fi++) { DelaunayHull.Add(Site.Vtx[MTX[f][fi]]); }
+							const int32 SiteFace = static_cast<int32>(FacesUsage[r] & 0xFFFFFFFF);
+							FDelaunaySite3& Site = Sites[SiteFace / 4];
+							const int32 f = SiteFace % 4;
+
+							for (int fi = 0; fi < 3; fi++) { DelaunayHull[Site.Vtx[MTX[f][fi]]] = true; }
 							Site.bOnHull = true;
 						}
 					}
+
+					RunStart = RunEnd;
 				}
 			}
 
@@ -363,24 +472,163 @@ namespace PCGExGeo
 			return IsValid;
 		}
 
-		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
+		/**
+		 * Whether the current tetrahedra are still a Delaunay tetrahedralization of the given (moved) positions:
+		 * every point is used, no tetrahedron flipped, every shared face passes the empty sphere test and the hull is still convex.
+		 */
+		bool IsStillDelaunay(const TArrayView<FVector>& Positions)
 		{
-			uint64 Edge;
-			for (const FDelaunaySite3& Site : Sites)
+			if (!IsValid || Sites.IsEmpty() || DelaunayHull.Num() != Positions.Num()) { return false; }
+
+			using namespace UE::Geometry;
+
+			if (FaceNeighbors.IsEmpty()) { BuildFaceNeighbors(); }
+
+			const FVector* P = Positions.GetData();
+
+			TBitArray<> Used;
+			Used.Init(false, Positions.Num());
+
+			// Hull edge, far vertex of the hull face across it; interior side of the hull face itself
+			struct FHullEdge
+			{
+				uint64 Edge;
+				int32 Face[3];
+				int32 Interior;
+				int32 Far;
+			};
+
+			TArray<FHullEdge> HullEdges;
+
+			for (int i = 0; i < Sites.Num(); i++)
 			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
+				const FDelaunaySite3& Site = Sites[i];
+				const double Sign = Site.Orientation;
+				if (Sign == 0) { return false; }
+
+				const FVector& A = P[Site.Vtx[0]];
+				const FVector& B = P[Site.Vtx[1]];
+				const FVector& C = P[Site.Vtx[2]];
+				const FVector& D = P[Site.Vtx[3]];
+
+				if (ExactPredicates::Orient3(A, B, C, D) * Sign <= 0) { return false; }
+
+				for (int f = 0; f < 4; f++)
+				{
+					Used[Site.Vtx[f]] = true;
+
+					const int32 Neighbor = FaceNeighbors[i * 4 + f];
+
+					if (Neighbor == -1)
+					{
+						const int32 V0 = Site.Vtx[MTX[f][0]];
+						const int32 V1 = Site.Vtx[MTX[f][1]];
+						const int32 V2 = Site.Vtx[MTX[f][2]];
+						const int32 Interior = Site.Vtx[3 - f];
+
+						HullEdges.Add(FHullEdge{PCGEx::H64U(V0, V1), {V0, V1, V2}, Interior, V2});
+						HullEdges.Add(FHullEdge{PCGEx::H64U(V0, V2), {V0, V1, V2}, Interior, V1});
+						HullEdges.Add(FHullEdge{PCGEx::H64U(V1, V2), {V0, V1, V2}, Interior, V0});
+						continue;
+					}
+
+					// Each shared face is tested once, from its lowest site
+					if (Neighbor < i) { continue; }
+
+					const int32 Opposite = Sites[Neighbor].Vtx[3 - NeighborFaces[i * 4 + f]];
+					if (ExactPredicates::InSphere3(A, B, C, D, P[Opposite]) * Sign > 0) { return false; }
+				}
 			}
+
+			for (int i = 0; i < Positions.Num(); i++) { if (!Used[i]) { return false; } }
+
+			// Every hull edge is shared by exactly two hull faces, each bending toward the inside of the other
+			HullEdges.Sort([](const FHullEdge& L, const FHullEdge& R) { return L.Edge < R.Edge; });
+			for (int i = 0; i < HullEdges.Num(); i += 2)
+			{
+				if (i + 1 >= HullEdges.Num() || HullEdges[i].Edge != HullEdges[i + 1].Edge) { return false; }
+				if (i + 2 < HullEdges.Num() && HullEdges[i + 2].Edge == HullEdges[i].Edge) { return false; }
+
+				for (int s = 0; s < 2; s++)
+				{
+					const FHullEdge& Self = HullEdges[i + s];
+					const FHullEdge& Other = HullEdges[i + 1 - s];
+
+					const FVector& A = P[Self.Face[0]];
+					const FVector& B = P[Self.Face[1]];
+					const FVector& C = P[Self.Face[2]];
+
+					const double Inside = FMath::Sign(ExactPredicates::Orient3(A, B, C, P[Self.Interior]));
+					if (ExactPredicates::Orient3(A, B, C, P[Other.Far]) * Inside <= 0) { return false; }
+				}
+			}
+
+			return true;
+		}
+
+		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
+		{
+			TArray<uint64> LongestEdges;
+			GetLongestEdges(Positions, LongestEdges);
+			RemoveValues(DelaunayEdges, LongestEdges);
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
 		{
-			uint64 Edge;
-			for (const FDelaunaySite3& Site : Sites)
+			TArray<uint64> SiteLongestEdges;
+			GetLongestEdges(Positions, SiteLongestEdges);
+			RemoveValues(DelaunayEdges, SiteLongestEdges);
+			LongestEdges.Append(SiteLongestEdges);
+		}
+
+		void GetLongestEdges(const TArrayView<FVector>& Positions, TArray<uint64>& OutEdges) const
+		{
+			OutEdges.SetNumUninitialized(Sites.Num());
+			for (int i = 0; i < Sites.Num(); i++) { GetLongestEdge(Positions, Sites[i].Vtx, OutEdges[i]); }
+			StableUnique(OutEdges);
+		}
+
+	protected:
+		void BuildFaceNeighbors()
+		{
+			// Faces are matched by their exact (sorted) vertices, not by hash
+			struct FFaceKey
+			{
+				int32 Vtx[3];
+				int32 SiteFace;
+
+				bool operator<(const FFaceKey& Other) const
+				{
+					if (Vtx[0] != Other.Vtx[0]) { return Vtx[0] < Other.Vtx[0]; }
+					if (Vtx[1] != Other.Vtx[1]) { return Vtx[1] < Other.Vtx[1]; }
+					return Vtx[2] < Other.Vtx[2];
+				}
+
+				bool SameFace(const FFaceKey& Other) const { return Vtx[0] == Other.Vtx[0] && Vtx[1] == Other.Vtx[1] && Vtx[2] == Other.Vtx[2]; }
+			};
+
+			TArray<FFaceKey> Keys;
+			Keys.SetNumUninitialized(Sites.Num() * 4);
+
+			for (int i = 0; i < Sites.Num(); i++)
+			{
+				const FDelaunaySite3& Site = Sites[i];
+				for (int f = 0; f < 4; f++) { Keys[i * 4 + f] = FFaceKey{{Site.Vtx[MTX[f][0]], Site.Vtx[MTX[f][1]], Site.Vtx[MTX[f][2]]}, i * 4 + f}; }
+			}
+
+			Keys.Sort();
+
+			FaceNeighbors.Init(-1, Sites.Num() * 4);
+			NeighborFaces.Init(-1, Sites.Num() * 4);
+			for (int i = 0; i + 1 < Keys.Num(); i++)
 			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
-				LongestEdges.Add(Edge);
+				if (!Keys[i].SameFace(Keys[i + 1])) { continue; }
+
+				FaceNeighbors[Keys[i].SiteFace] = Keys[i + 1].SiteFace / 4;
+				FaceNeighbors[Keys[i + 1].SiteFace] = Keys[i].SiteFace / 4;
+				NeighborFaces[Keys[i].SiteFace] = Keys[i + 1].SiteFace % 4;
+				NeighborFaces[Keys[i + 1].SiteFace] = Keys[i].SiteFace % 4;
+				i++;
 			}
 		}
 	};
@@ -0,0 +1,287 @@
+﻿// Copyright 2024 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGEx.h"
+#include "PCGExMath.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Static k-d tree over a fixed set of locations, built once and shared read-only across threads.
+	 * Locations are stored as flat X/Y/Z arrays in tree order; nodes are implicit (children of N are 2N+1 & 2N+2)
+	 * and each cover a contiguous range of that order.
+	 *
+	 * Each location may carry a reach: how far the position actually measured against may stray from it
+	 * (e.g. bounds-based distances). Queries account for it so pruning remains exact.
+	 * Distances are always evaluated by the caller; ties resolve to the lowest index, like a linear scan would.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FPointKNNIndex : public TSharedFromThis<FPointKNNIndex>
+	{
+		static constexpr int32 LeafSize = 8;
+		static constexpr int32 MaxDepth = 24;
+
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			double Reach = 0;
+			int32 Start = 0;
+			int32 End = 0;
+		};
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<int32> Order;
+		TArray<double> X;
+		TArray<double> Y;
+		TArray<double> Z;
+		TArray<double> Reach; // Empty if no location has any reach
+		int32 Depth = 0;
+		int32 FirstLeaf = 0;
+
+	public:
+		explicit FPointKNNIndex(const TConstArrayView<FVector> InLocations, const TConstArrayView<double> InReach = TConstArrayView<double>())
+		{
+			const int32 NumLocations = InLocations.Num();
+			if (!NumLocations) { return; }
+
+			check(InReach.IsEmpty() || InReach.Num() == NumLocations);
+
+			while (Depth < MaxDepth && (NumLocations >> Depth) > LeafSize) { Depth++; }
+			FirstLeaf = (1 << Depth) - 1;
+
+			Nodes.SetNum((1 << (Depth + 1)) - 1);
+			PCGEx::ArrayOfIndices(Order, NumLocations);
+
+			Build(InLocations, InReach, 0, 0, NumLocations, 0);
+
+			X.SetNumUninitialized(NumLocations);
+			Y.SetNumUninitialized(NumLocations);
+			Z.SetNumUninitialized(NumLocations);
+			if (!InReach.IsEmpty()) { Reach.SetNumUninitialized(NumLocations); }
+
+			for (int i = 0; i < NumLocations; i++)
+			{
+				const FVector& Location = InLocations[Order[i]];
+				X[i] = Location.X;
+				Y[i] = Location.Y;
+				Z[i] = Location.Z;
+				if (!Reach.IsEmpty()) { Reach[i] = InReach[Order[i]]; }
+			}
+		}
+
+		FORCEINLINE int32 Num() const { return Order.Num(); }
+
+		/**
+		 * Returns the index with the smallest GetDistSquared, or -1 if the index is empty.
+		 * @param Slack How far the query's own measured position may stray from Location
+		 */
+		template <typename FDistFunc>
+		int32 FindNearest(const FVector& Location, const double Slack, FDistFunc&& GetDistSquared, double& OutDistSquared) const
+		{
+			int32 Best = -1;
+			OutDistSquared = MAX_dbl;
+
+			if (Order.IsEmpty()) { return Best; }
+
+			int32 Stack[MaxDepth + 2];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const int32 NodeIndex = Stack[--StackSize];
+				const FNode& Node = Nodes[NodeIndex];
+
+				if (Node.Start >= Node.End || MinDistSquared(Node.Bounds, Location, Slack + Node.Reach) > OutDistSquared) { continue; }
+
+				if (NodeIndex >= FirstLeaf)
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						if (Shrink(DistSquared(i, Location), Slack + GetReach(i)) > OutDistSquared) { continue; }
+
+						const int32 Index = Order[i];
+						const double Dist = GetDistSquared(Index);
+						if (Dist < OutDistSquared || (Dist == OutDistSquared && Index < Best))
+						{
+							Best = Index;
+							OutDistSquared = Dist;
+						}
+					}
+
+					continue;
+				}
+
+				// Push the farthest child first so the closest one is explored first
+				const int32 Left = NodeIndex * 2 + 1;
+				const int32 Right = Left + 1;
+				const bool bLeftFirst = ComputeSquaredDistanceFromBoxToPoint(Nodes[Left].Bounds.Min, Nodes[Left].Bounds.Max, Location) <=
+					ComputeSquaredDistanceFromBoxToPoint(Nodes[Right].Bounds.Min, Nodes[Right].Bounds.Max, Location);
+
+				Stack[StackSize++] = bLeftFirst ? Right : Left;
+				Stack[StackSize++] = bLeftFirst ? Left : Right;
+			}
+
+			return Best;
+		}
+
+		/**
+		 * Returns the index with the largest GetDistSquared, or -1 if the index is empty.
+		 * @param Slack How far the query's own measured position may stray from Location
+		 */
+		template <typename FDistFunc>
+		int32 FindFarthest(const FVector& Location, const double Slack, FDistFunc&& GetDistSquared, double& OutDistSquared) const
+		{
+			int32 Best = -1;
+			OutDistSquared = -1;
+
+			if (Order.IsEmpty()) { return Best; }
+
+			int32 Stack[MaxDepth + 2];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const int32 NodeIndex = Stack[--StackSize];
+				const FNode& Node = Nodes[NodeIndex];
+
+				if (Node.Start >= Node.End || MaxDistSquared(Node.Bounds, Location, Slack + Node.Reach) < OutDistSquared) { continue; }
+
+				if (NodeIndex >= FirstLeaf)
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						if (Grow(DistSquared(i, Location), Slack + GetReach(i)) < OutDistSquared) { continue; }
+
+						const int32 Index = Order[i];
+						const double Dist = GetDistSquared(Index);
+						if (Dist > OutDistSquared || (Dist == OutDistSquared && Index < Best))
+						{
+							Best = Index;
+							OutDistSquared = Dist;
+						}
+					}
+
+					continue;
+				}
+
+				// Push the closest child first so the farthest one is explored first
+				const int32 Left = NodeIndex * 2 + 1;
+				const int32 Right = Left + 1;
+				const bool bLeftFirst = MaxDistSquared(Nodes[Left].Bounds, Location, 0) >= MaxDistSquared(Nodes[Right].Bounds, Location, 0);
+
+				Stack[StackSize++] = bLeftFirst ? Right : Left;
+				Stack[StackSize++] = bLeftFirst ? Left : Right;
+			}
+
+			return Best;
+		}
+
+		/**
+		 * Gathers every index whose location, padded by its reach, lies within Radius of Location.
+		 * Results are sorted by index.
+		 */
+		void FindWithinRadius(const FVector& Location, const double Radius, TArray<int32>& OutIndices) const
+		{
+			OutIndices.Reset();
+			if (Order.IsEmpty()) { return; }
+
+			int32 Stack[MaxDepth + 2];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const int32 NodeIndex = Stack[--StackSize];
+				const FNode& Node = Nodes[NodeIndex];
+
+				if (Node.Start >= Node.End ||
+					ComputeSquaredDistanceFromBoxToPoint(Node.Bounds.Min, Node.Bounds.Max, Location) > FMath::Square(Radius + Node.Reach)) { continue; }
+
+				if (NodeIndex >= FirstLeaf)
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						if (DistSquared(i, Location) <= FMath::Square(Radius + GetReach(i))) { OutIndices.Add(Order[i]); }
+					}
+
+					continue;
+				}
+
+				Stack[StackSize++] = NodeIndex * 2 + 2;
+				Stack[StackSize++] = NodeIndex * 2 + 1;
+			}
+
+			OutIndices.Sort();
+		}
+
+	protected:
+		void Build(const TConstArrayView<FVector>& InLocations, const TConstArrayView<double>& InReach, const int32 NodeIndex, const int32 Start, const int32 End, const int32 Level)
+		{
+			FNode& Node = Nodes[NodeIndex];
+			Node.Start = Start;
+			Node.End = End;
+
+			for (int32 i = Start; i < End; i++)
+			{
+				Node.Bounds += InLocations[Order[i]];
+				if (!InReach.IsEmpty()) { Node.Reach = FMath::Max(Node.Reach, InReach[Order[i]]); }
+			}
+
+			if (Level == Depth) { return; }
+
+			const int32 Mid = Start + (End - Start) / 2;
+
+			if (End - Start > 1)
+			{
+				const FVector Size = Node.Bounds.GetSize();
+				const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+
+				Sort(
+					Order.GetData() + Start, End - Start, [&](const int32 A, const int32 B)
+					{
+						const double VA = InLocations[A][Axis];
+						const double VB = InLocations[B][Axis];
+						return VA == VB ? A < B : VA < VB;
+					});
+			}
+
+			Build(InLocations, InReach, NodeIndex * 2 + 1, Start, Mid, Level + 1);
+			Build(InLocations, InReach, NodeIndex * 2 + 2, Mid, End, Level + 1);
+		}
+
+		FORCEINLINE double GetReach(const int32 Slot) const { return Reach.IsEmpty() ? 0 : Reach[Slot]; }
+
+		FORCEINLINE double DistSquared(const int32 Slot, const FVector& Location) const
+		{
+			return FMath::Square(X[Slot] - Location.X) + FMath::Square(Y[Slot] - Location.Y) + FMath::Square(Z[Slot] - Location.Z);
+		}
+
+		// Lower bound of a squared distance once both ends may move closer by Amount
+		FORCEINLINE static double Shrink(const double InDistSquared, const double Amount)
+		{
+			return Amount <= 0 ? InDistSquared : FMath::Square(FMath::Max(0.0, FMath::Sqrt(InDistSquared) - Amount));
+		}
+
+		// Upper bound of a squared distance once both ends may move apart by Amount
+		FORCEINLINE static double Grow(const double InDistSquared, const double Amount)
+		{
+			return Amount <= 0 ? InDistSquared : FMath::Square(FMath::Sqrt(InDistSquared) + Amount);
+		}
+
+		FORCEINLINE static double MinDistSquared(const FBox& Box, const FVector& Location, const double Amount)
+		{
+			return Shrink(ComputeSquaredDistanceFromBoxToPoint(Box.Min, Box.Max, Location), Amount);
+		}
+
+		FORCEINLINE static double MaxDistSquared(const FBox& Box, const FVector& Location, const double Amount)
+		{
+			const FVector Far = FVector::Max((Location - Box.Min).GetAbs(), (Box.Max - Location).GetAbs());
+			return Grow(Far.SizeSquared(), Amount);
+		}
+	};
+}
@@ -40,6 +40,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=1))
 	int32 Iterations = 100;
 
+	/** Stop iterating early once no point moves by more than a threshold over an iteration. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bStopOnConvergence = false;
+
+	/** Largest displacement under which the relaxation is considered settled. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bStopOnConvergence", ClampMin=0))
+	double ConvergenceThreshold = 0.01;
+
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
@@ -48,6 +56,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Settings, Instanced, meta=(PCG_Overridable, NoResetToDefault, ShowOnlyInnerProperties))
 	TObjectPtr<UPCGExRelaxClusterOperation> Relaxing;
 
+	/** Run every iteration on a fixed set of workers synced by a lightweight barrier, instead of scheduling a new task group per iteration. Cuts scheduling overhead on high iteration counts, but workers keep their thread until relaxation is done. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bPersistentWorkers = false;
+
 private:
 	friend class FPCGExRelaxClustersElement;
 };
@@ -89,6 +101,15 @@ namespace PCGExRelaxClusters
 
 		FPCGExInfluenceDetails InfluenceDetails;
 
+		// With persistent workers, all iterations run on a fixed set of workers claiming static node partitions.
+		// Whoever completes the last partition of an iteration swaps buffers and opens the next one.
+		TArray<PCGExMT::FScope> Partitions;
+		TArray<double> PartitionDisplacement; // Max squared displacement, per partition
+		std::atomic<int32> NextPartition{0};
+		std::atomic<int32> CompletedPartitions{0};
+		std::atomic<int32> Generation{0};
+		std::atomic<bool> bStopIterating{false};
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -99,9 +120,17 @@ namespace PCGExRelaxClusters
 
 		virtual TSharedPtr<PCGExCluster::FCluster> HandleCachedCluster(const TSharedRef<PCGExCluster::FCluster>& InClusterRef) override;
 		virtual bool Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
+		void StartRelaxing();
 		void StartRelaxIteration();
+		void RunIterations();
+		void ProcessPartition(const int32 PartitionIndex);
 		virtual void ProcessSingleNode(const int32 Index, PCGExCluster::FNode& Node, const PCGExMT::FScope& Scope) override;
 		virtual void Write() override;
+
+	protected:
+		bool ShouldStop() const;
+		void BeginIteration();
+		void EndIteration();
 	};
 
 	class FRelaxRangeTask final : public PCGExMT::FScopeIterationTask
@@ -116,4 +145,17 @@ namespace PCGExRelaxClusters
 		TSharedPtr<FProcessor> Processor;
 		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override;
 	};
+
+	class FRelaxWorkerTask final : public PCGExMT::FScopeIterationTask
+	{
+	public:
+		FRelaxWorkerTask(const TSharedPtr<FProcessor>& InProcessor):
+			FScopeIterationTask(),
+			Processor(InProcessor)
+		{
+		}
+
+		TSharedPtr<FProcessor> Processor;
+		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override;
+	};
 }
@@ -5,8 +5,16 @@
 
 #include "CoreMinimal.h"
 #include "PCGExRelaxClusterOperation.h"
+#include "Geometry/PCGExGeoBarnesHut.h"
 #include "PCGExForceDirectedRelax.generated.h"
 
+UENUM()
+enum class EPCGExForceDirectedRepulsion : uint8
+{
+	Neighbors = 0 UMETA(DisplayName = "Neighbors", ToolTip="Nodes only repel the nodes they are connected to."),
+	Global    = 1 UMETA(DisplayName = "Global", ToolTip="Every node repels every other node. Distant groups of nodes are approximated (Barnes-Hut)."),
+};
+
 /**
  * 
  */
@@ -23,31 +31,67 @@ public:
 		{
 			SpringConstant = TypedOther->SpringConstant;
 			ElectrostaticConstant = TypedOther->ElectrostaticConstant;
+			Repulsion = TypedOther->Repulsion;
+			Theta = TypedOther->Theta;
 		}
 	}
 
+	virtual void PrepareStep() override
+	{
+		if (Repulsion != EPCGExForceDirectedRepulsion::Global) { return; }
+
+		if (!RepulsionTree) { RepulsionTree = MakeShared<PCGExGeo::FBarnesHutTree>(); }
+		RepulsionTree->Rebuild(*ReadBuffer);
+	}
+
 	virtual void ProcessExpandedNode(const PCGExCluster::FNode& Node) override
 	{
 		const FVector Position = *(ReadBuffer->GetData() + Node.Index);
 		FVector Force = FVector::Zero();
 
-		for (const PCGExGraph::FLink& Lk : Node.Links)
+		if (Repulsion == EPCGExForceDirectedRepulsion::Global)
+		{
+			for (const PCGExGraph::FLink& Lk : Node.Links) { CalculateAttractiveForce(Force, Position, *(ReadBuffer->GetData() + Lk.Node)); }
+			RepulsionTree->ForEachBody(
+				Position, Node.Index, Theta,
+				[&](const FVector& OtherPosition, const double Mass) { CalculateRepulsiveForce(Force, Position, OtherPosition, Mass); });
+		}
+		else
 		{
-			const FVector OtherPosition = *(ReadBuffer->GetData() + Lk.Node);
-			CalculateAttractiveForce(Force, Position, OtherPosition);
-			CalculateRepulsiveForce(Force, Position, OtherPosition);
+			for (const PCGExGraph::FLink& Lk : Node.Links)
+			{
+				const FVector OtherPosition = *(ReadBuffer->GetData() + Lk.Node);
+				CalculateAttractiveForce(Force, Position, OtherPosition);
+				CalculateRepulsiveForce(Force, Position, OtherPosition);
+			}
 		}
 
 		(*WriteBuffer)[Node.Index] = Position + Force;
 	}
 
+	virtual void Cleanup() override
+	{
+		RepulsionTree.Reset();
+		Super::Cleanup();
+	}
+
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double SpringConstant = 0.1;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double ElectrostaticConstant = 1000;
 
+	/** Which nodes repel each other. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExForceDirectedRepulsion Repulsion = EPCGExForceDirectedRepulsion::Neighbors;
+
+	/** Approximation threshold : groups of nodes whose size over distance is below this value act as a single body. 0 is exact, but O(N²). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0, EditCondition="Repulsion == EPCGExForceDirectedRepulsion::Global", EditConditionHides))
+	double Theta = 0.5;
+
 protected:
+	TSharedPtr<PCGExGeo::FBarnesHutTree> RepulsionTree;
+
 	FORCEINLINE void CalculateAttractiveForce(FVector& Force, const FVector& A, const FVector& B) const
 	{
 		// Calculate the displacement vector between the nodes
@@ -61,7 +105,7 @@ protected:
 		Force += Displacement * ForceMagnitude;
 	}
 
-	FORCEINLINE void CalculateRepulsiveForce(FVector& Force, const FVector& A, const FVector& B) const
+	FORCEINLINE void CalculateRepulsiveForce(FVector& Force, const FVector& A, const FVector& B, const double Mass = 1) const
 	{
 		// Calculate the displacement vector between the nodes
 		FVector Displacement = B - A;
@@ -70,7 +114,7 @@ protected:
 		Displacement /= Distance;
 
 		// Calculate the force magnitude using Coulomb's law
-		const double ForceMagnitude = ElectrostaticConstant / (Distance * Distance);
+		const double ForceMagnitude = Mass * ElectrostaticConstant / (Distance * Distance);
 		Force -= Displacement * ForceMagnitude;
 	}
 };
@@ -38,6 +38,11 @@ public:
 		Cluster = InCluster;
 	}
 
+	/** Called once per iteration, after buffers are swapped and before any node is processed. */
+	virtual void PrepareStep()
+	{
+	}
+
 	virtual void ProcessExpandedNode(const PCGExCluster::FNode& Node)
 	{
 	}
@@ -140,6 +140,9 @@ namespace PCGExCluster
 		TSharedPtr<TArray<double>> EdgeLengths;
 		TArray<FVector> NodePositions;
 
+		// Flat node adjacency (CSR), nodes' Links are views into this buffer when it is valid
+		TSharedPtr<TArray<FLink>> Adjacency;
+
 		FBox Bounds;
 
 		const TArray<FPCGPoint>* VtxPoints = nullptr;
@@ -164,7 +167,7 @@ namespace PCGExCluster
 		~FCluster();
 
 		bool BuildFrom(
-			const TMap<uint32, int32>& InEndpointsLookup,
+			const TArray<uint64>& InEndpointsLookup,
 			const TArray<int32>* InExpectedAdjacency,
 			const PCGExData::ESource PointsSource = PCGExData::ESource::In);
 
@@ -515,6 +518,9 @@ namespace PCGExCluster
 		void UpdatePositions();
 
 	protected:
+		void BuildFlatAdjacency(const TArray<int32>& InEdgeNodes);
+		void BuildOwnedAdjacency(const TArray<int32>& InEdgeNodes);
+
 		FORCEINLINE int32 GetOrCreateNodeUnsafe(const TArray<FPCGPoint>& InNodePoints, const int32 PointIndex)
 		{
 			int32 NodeIndex = NodeIndexLookup->Get(PointIndex);
@@ -109,7 +109,7 @@ namespace PCGExClusterMT
 
 		int32 BatchIndex = -1;
 
-		TMap<uint32, int32>* EndpointsLookup = nullptr;
+		TArray<uint64>* EndpointsLookup = nullptr;
 		TArray<int32>* ExpectedAdjacency = nullptr;
 
 		TSharedPtr<PCGExCluster::FCluster> Cluster;
@@ -347,9 +347,8 @@ namespace PCGExClusterMT
 		TSharedPtr<PCGExData::FFacadePreloader> VtxFacadePreloader;
 
 		const FPCGMetadataAttribute<int64>* RawLookupAttribute = nullptr;
-		TArray<uint32> ReverseLookup;
 
-		TMap<uint32, int32> EndpointsLookup;
+		TArray<uint64> EndpointsLookup;
 		TArray<int32> ExpectedAdjacency;
 
 		bool bPreparationSuccessful = false;
@@ -426,7 +425,7 @@ namespace PCGExClusterMT
 				// Spread
 				PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManagerPtr, BuildEndpointLookupTask)
 
-				PCGEx::InitArray(ReverseLookup, NumVtx);
+				PCGEx::InitArray(EndpointsLookup, NumVtx);
 				PCGEx::InitArray(ExpectedAdjacency, NumVtx);
 
 				RawLookupAttribute = VtxDataFacade->GetIn()->Metadata->GetConstTypedAttribute<int64>(PCGExGraph::Tag_VtxEndpoint);
@@ -439,10 +438,7 @@ namespace PCGExClusterMT
 
 						PCGEX_ASYNC_THIS
 
-						const int32 Num = This->VtxDataFacade->GetNum();
-						This->EndpointsLookup.Reserve(Num);
-						for (int i = 0; i < Num; i++) { This->EndpointsLookup.Add(This->ReverseLookup[i], i); }
-						This->ReverseLookup.Empty();
+						This->EndpointsLookup.Sort();
 
 						if (This->RequiresGraphBuilder())
 						{
@@ -466,7 +462,7 @@ namespace PCGExClusterMT
 							uint32 B;
 							PCGEx::H64(This->RawLookupAttribute->GetValueFromItemKey(InKeys[i].MetadataEntry), A, B);
 
-							This->ReverseLookup[i] = A;
+							This->EndpointsLookup[i] = PCGEx::H64(A, i);
 							This->ExpectedAdjacency[i] = B;
 						}
 					};
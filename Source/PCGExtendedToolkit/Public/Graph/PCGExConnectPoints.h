@@ -106,7 +106,7 @@ namespace PCGExConnectPoints
 		const TArray<FPCGPoint>* InPoints = nullptr;
 		TArray<FTransform> CachedTransforms;
 
-		TArray<TSharedPtr<TSet<uint64>>> DistributedEdgesSet;
+		TArray<TArray<uint64>> DistributedEdges; // One bucket per loop scope, deduplicated when inserted into the graph
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
 
 		bool bPreventCoincidence = false;
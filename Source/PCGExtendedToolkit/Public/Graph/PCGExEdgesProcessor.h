@@ -61,7 +61,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExEdgesProcessorContext : FPCGExPointsProc
 
 	TSharedPtr<PCGExData::FPointIOTaggedDictionary> InputDictionary;
 	TSharedPtr<PCGExData::FPointIOTaggedEntries> TaggedEdges;
-	TMap<uint32, int32> EndpointsLookup;
+	TArray<uint64> EndpointsLookup;
 	TArray<int32> EndpointsAdjacency;
 
 	const TArray<FPCGExSortRuleConfig>* GetEdgeSortingRules() const;
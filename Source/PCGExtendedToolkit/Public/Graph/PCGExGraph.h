@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 
+#include "Algo/BinarySearch.h"
 #include "Data/PCGExAttributeHelpers.h"
 #include "PCGExGlobalSettings.h"
 #include "PCGExMT.h"
@@ -162,9 +163,75 @@ namespace PCGExGraph
 
 #pragma region Graph Utils
 
+	/**
+	 * Resolves a vtx endpoint id against a flat endpoints lookup (see BuildEndpointsLookup).
+	 * Returns the matching vtx point index, or -1 if the id is unknown.
+	 * Duplicate ids resolve to the highest point index, like the map-based lookup it replaces did.
+	 */
+	FORCEINLINE static int32 FindEndpoint(const TArray<uint64>& EndpointsLookup, const uint32 Id)
+	{
+		const int32 Index = Algo::UpperBound(EndpointsLookup, PCGEx::H64(Id, MAX_uint32)) - 1;
+		if (Index < 0 || PCGEx::H64A(EndpointsLookup[Index]) != Id) { return -1; }
+		return static_cast<int32>(PCGEx::H64B(EndpointsLookup[Index]));
+	}
+
+	/**
+	 * Sorts edge hashes & removes duplicates, in place.
+	 * LSD radix sort over 16-bit digits; passes where all hashes share the same digit are skipped,
+	 * which is frequent since hashes pack two node indices that rarely use all their bits.
+	 */
+	static void SortUniqueEdgeHashes(TArray<uint64>& InOutHashes)
+	{
+		const int32 Num = InOutHashes.Num();
+		if (Num <= 1) { return; }
+
+		if (Num < 4096) { InOutHashes.Sort(); }
+		else
+		{
+			TArray<uint64> Scratch;
+			Scratch.SetNumUninitialized(Num);
+
+			TArray<int32> Counts;
+			Counts.SetNumUninitialized(1 << 16);
+
+			uint64* Src = InOutHashes.GetData();
+			uint64* Dst = Scratch.GetData();
+
+			for (int32 Shift = 0; Shift < 64; Shift += 16)
+			{
+				FMemory::Memzero(Counts.GetData(), Counts.Num() * sizeof(int32));
+				for (int i = 0; i < Num; i++) { Counts[(Src[i] >> Shift) & 0xFFFF]++; }
+
+				if (Counts[(Src[0] >> Shift) & 0xFFFF] == Num) { continue; }
+
+				int32 Sum = 0;
+				for (int32& Count : Counts)
+				{
+					const int32 Digit = Count;
+					Count = Sum;
+					Sum += Digit;
+				}
+
+				for (int i = 0; i < Num; i++) { Dst[Counts[(Src[i] >> Shift) & 0xFFFF]++] = Src[i]; }
+				Swap(Src, Dst);
+			}
+
+			if (Src != InOutHashes.GetData()) { FMemory::Memcpy(InOutHashes.GetData(), Src, Num * sizeof(uint64)); }
+		}
+
+		int32 WriteIndex = 1;
+		for (int i = 1; i < Num; i++) { if (InOutHashes[i] != InOutHashes[WriteIndex - 1]) { InOutHashes[WriteIndex++] = InOutHashes[i]; } }
+
+#if PCGEX_ENGINE_VERSION <= 503
+		InOutHashes.SetNum(WriteIndex, false);
+#else
+		InOutHashes.SetNum(WriteIndex, EAllowShrinking::No);
+#endif
+	}
+
 	static bool BuildIndexedEdges(
 		const TSharedPtr<PCGExData::FPointIO>& EdgeIO,
-		const TMap<uint32, int32>& EndpointsLookup,
+		const TArray<uint64>& EndpointsLookup,
 		TArray<FEdge>& OutEdges,
 		const bool bStopOnError = false)
 	{
@@ -173,7 +240,7 @@ namespace PCGExGraph
 		const TUniquePtr<PCGExData::TBuffer<int64>> EndpointsBuffer = MakeUnique<PCGExData::TBuffer<int64>>(EdgeIO.ToSharedRef(), Tag_EdgeEndpoints);
 		if (!EndpointsBuffer->PrepareRead()) { return false; }
 
-		const TArray<int64>& Endpoints = *EndpointsBuffer->GetInValues().Get();
+		const PCGExData::TColumn<int64>& Endpoints = *EndpointsBuffer->GetInValues().Get();
 		const int32 EdgeIOIndex = EdgeIO->IOIndex;
 
 		bool bValid = true;
@@ -191,12 +258,12 @@ namespace PCGExGraph
 				uint32 B;
 				PCGEx::H64(Endpoints[i], A, B);
 
-				const int32* StartPointIndexPtr = EndpointsLookup.Find(A);
-				const int32* EndPointIndexPtr = EndpointsLookup.Find(B);
+				const int32 StartPointIndex = FindEndpoint(EndpointsLookup, A);
+				const int32 EndPointIndex = FindEndpoint(EndpointsLookup, B);
 
-				if ((!StartPointIndexPtr || !EndPointIndexPtr)) { continue; }
+				if (StartPointIndex == -1 || EndPointIndex == -1) { continue; }
 
-				OutEdges[EdgeIndex] = FEdge(EdgeIndex, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+				OutEdges[EdgeIndex] = FEdge(EdgeIndex, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 				EdgeIndex++;
 			}
 
@@ -210,16 +277,16 @@ namespace PCGExGraph
 				uint32 B;
 				PCGEx::H64(Endpoints[i], A, B);
 
-				const int32* StartPointIndexPtr = EndpointsLookup.Find(A);
-				const int32* EndPointIndexPtr = EndpointsLookup.Find(B);
+				const int32 StartPointIndex = FindEndpoint(EndpointsLookup, A);
+				const int32 EndPointIndex = FindEndpoint(EndpointsLookup, B);
 
-				if ((!StartPointIndexPtr || !EndPointIndexPtr))
+				if (StartPointIndex == -1 || EndPointIndex == -1)
 				{
 					bValid = false;
 					break;
 				}
 
-				OutEdges[i] = FEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+				OutEdges[i] = FEdge(i, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 			}
 		}
 
@@ -332,6 +399,92 @@ namespace PCGExGraph
 		}
 	};
 
+	/**
+	 * Node adjacency list.
+	 * Either owns its links (incremental graph building), or views a slice of a
+	 * flat, cluster-owned compressed-sparse-row buffer (see FCluster::Adjacency).
+	 * Reads always go through Data/Count so both modes iterate contiguous memory.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FNodeLinks
+	{
+		TArray<FLink> Owned;
+		FLink* Data = nullptr;
+		int32 Count = 0;
+
+		FORCEINLINE void Sync()
+		{
+			Data = Owned.GetData();
+			Count = Owned.Num();
+		}
+
+	public:
+		FNodeLinks() = default;
+
+		FNodeLinks(const FNodeLinks& Other) { *this = Other; }
+
+		FNodeLinks& operator=(const FNodeLinks& Other)
+		{
+			if (this == &Other) { return *this; }
+			if (Other.IsView()) { View(Other.Data, Other.Count); }
+			else
+			{
+				Owned = Other.Owned;
+				Sync();
+			}
+			return *this;
+		}
+
+		FORCEINLINE bool IsView() const { return Data && Data != Owned.GetData(); }
+
+		FORCEINLINE void View(FLink* InData, const int32 InCount)
+		{
+			Owned.Empty();
+			Data = InData;
+			Count = InCount;
+		}
+
+		FORCEINLINE int32 Num() const { return Count; }
+		FORCEINLINE bool IsEmpty() const { return Count == 0; }
+		FORCEINLINE bool IsValidIndex(const int32 Index) const { return Index >= 0 && Index < Count; }
+
+		FORCEINLINE FLink* GetData() const { return Data; }
+		FORCEINLINE FLink& operator[](const int32 Index) const { return *(Data + Index); }
+		FORCEINLINE FLink& Last(const int32 IndexFromTheEnd = 0) const { return *(Data + Count - IndexFromTheEnd - 1); }
+
+		FORCEINLINE FLink* begin() const { return Data; }
+		FORCEINLINE FLink* end() const { return Data + Count; }
+
+		FORCEINLINE void Empty()
+		{
+			Owned.Empty();
+			Data = nullptr;
+			Count = 0;
+		}
+
+		FORCEINLINE void Reserve(const int32 InNum)
+		{
+			check(!IsView())
+			Owned.Reserve(InNum);
+			Sync();
+		}
+
+		FORCEINLINE int32 Add(const FLink& InLink)
+		{
+			check(!IsView())
+			const int32 Index = Owned.Add(InLink);
+			Sync();
+			return Index;
+		}
+
+		FORCEINLINE int32 AddUnique(const FLink& InLink)
+		{
+			check(!IsView())
+			const int32 Index = Owned.AddUnique(InLink);
+			Sync();
+			return Index;
+		}
+	};
+
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FNode
 	{
 		FNode()
@@ -350,7 +503,7 @@ namespace PCGExGraph
 		int32 PointIndex = -1; // Index in the context of the UPCGPointData that helds the vtx
 		int32 NumExportedEdges = 0;
 
-		TArray<FLink> Links;
+		FNodeLinks Links;
 
 		~FNode() = default;
 
@@ -382,8 +535,8 @@ namespace PCGExGraph
 	public:
 		int64 Id = -1;
 		TWeakPtr<FGraph> WeakParentGraph;
-		TSet<int32> Nodes;
-		TSet<int32> Edges;
+		TArray<int32> Nodes; // Sorted
+		TArray<int32> Edges; // In discovery order
 		TSet<int32> EdgesInIOIndices;
 		TSharedPtr<PCGExData::FFacade> VtxDataFacade;
 		TSharedPtr<PCGExData::FFacade> EdgesDataFacade;
@@ -402,14 +555,6 @@ namespace PCGExGraph
 			PCGEX_LOG_DTR(FSubGraph)
 		}
 
-		FORCEINLINE void Add(const FEdge& Edge, FGraph* InGraph)
-		{
-			Nodes.Add(Edge.Start);
-			Nodes.Add(Edge.End);
-			Edges.Add(Edge.Index);
-			if (Edge.IOIndex >= 0) { EdgesInIOIndices.Add(Edge.IOIndex); }
-		}
-
 		void Invalidate(FGraph* InGraph);
 		void BuildCluster(const TSharedRef<PCGExCluster::FCluster>& InCluster);
 		int32 GetFirstInIOIndex();
@@ -449,6 +594,22 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		mutable FRWLock NodeMetadataLock;
 		const int32 NumEdgesReserve;
 
+		TArray<int32> Components; // Union-find parents while building subgraphs, then each node's component root
+		TArray<int8> VisitedNodes; // Walk flags while building subgraphs; bytes so disjoint subgraphs can be walked concurrently
+		TArray<int8> VisitedEdges;
+
+		int32 NumIndexedEdges = 0;                // Edges below this index are registered in UniqueEdges
+		TArray<TArray<uint64>> PendingEdgeBuckets; // Bulk insertion inputs, one per producer
+		TArray<TArray<uint64>> PendingEdgeSlices;  // Bulk insertion outputs, one per range of start nodes
+
+		FORCEINLINE void IndexEdgesUnsafe()
+		{
+			if (NumIndexedEdges == Edges.Num()) { return; }
+			UniqueEdges.Reserve(Edges.Num());
+			for (int i = NumIndexedEdges; i < Edges.Num(); i++) { UniqueEdges.Add(Edges[i].H64U(), i); }
+			NumIndexedEdges = Edges.Num();
+		}
+
 	public:
 		bool bBuildClusters = false;
 
@@ -502,8 +663,17 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		void InsertEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
 		int32 InsertEdges(const TArray<FEdge>& InEdges);
 
+		/**
+		 * Bulk insertion of edge hashes gathered by concurrent producers, one bucket each.
+		 * Buckets are radix-sorted & de-duplicated in parallel, then split by start node into slices that are merged in parallel;
+		 * new edges are appended in ascending hash order, skipping those already in the graph.
+		 * Must not run alongside any other insertion.
+		 */
+		void InsertEdges(TArray<TArray<uint64>>&& InBuckets, int32 InIOIndex, const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FCompletionCallback&& OnComplete);
+
 		FORCEINLINE FEdge* FindEdgeUnsafe(const uint64 Hash)
 		{
+			IndexEdgesUnsafe();
 			const int32* Index = UniqueEdges.Find(Hash);
 			if (!Index) { return nullptr; }
 			return (Edges.GetData() + *Index);
@@ -513,7 +683,8 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 		FORCEINLINE FEdge* FindEdge(const uint64 Hash)
 		{
-			FReadScopeLock ReadScopeLock(GraphLock);
+			FWriteScopeLock WriteScopeLock(GraphLock);
+			IndexEdgesUnsafe();
 			const int32* Index = UniqueEdges.Find(Hash);
 			if (!Index) { return nullptr; }
 			return (Edges.GetData() + *Index);
@@ -648,7 +819,12 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 		TArrayView<FNode> AddNodes(const int32 NumNewNodes);
 
-		void BuildSubGraphs(const FPCGExGraphBuilderDetails& Limits);
+		/**
+		 * Splits valid nodes & edges into connected subgraphs, ordered by their lowest node.
+		 * Nodes are sorted within each subgraph, edges are in depth-first discovery order from the lowest node.
+		 * Components are found with a concurrent union-find over edges, then each subgraph is walked on its own.
+		 */
+		void BuildSubGraphs(const FPCGExGraphBuilderDetails* Limits, const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FCompletionCallback&& OnComplete);
 
 		~FGraph()
 		{
@@ -656,6 +832,15 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		}
 
 		void GetConnectedNodes(int32 FromIndex, TArray<int32>& OutIndices, int32 SearchDepth) const;
+
+	protected:
+		void MergeEdgeBuckets(int32 InIOIndex, const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FCompletionCallback&& OnComplete);
+		void AppendEdgeSlices(int32 InIOIndex);
+
+		int32 FindComponent(int32 Index);
+		void UniteComponents(int32 A, int32 B);
+		void GatherSubGraphs(const FPCGExGraphBuilderDetails* Limits, const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FCompletionCallback&& OnComplete);
+		void WalkSubGraph(const TSharedRef<FSubGraph>& SubGraph, TArray<int32>& Stack);
 	};
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FGraphBuilder : public TSharedFromThis<FGraphBuilder>
@@ -717,6 +902,17 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		void CompileAsync(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager, const bool bWriteNodeFacade, const FGraphMetadataDetails* MetadataDetails = nullptr);
 		void Compile(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager, const bool bWriteNodeFacade, const FGraphMetadataDetails* MetadataDetails = nullptr);
 
+	protected:
+		TArray<int32> ValidNodes;
+		TArray<int32> PruneOffsets; // Per-scope write offsets into the pruned points
+		TArray<FPCGPoint> PrunedPoints;
+
+		void CompileSubGraphs();
+		void ScatterValidNodes();
+		void WriteVtxData();
+		void CompileEdges();
+
+	public:
 		void StageEdgesOutputs() const;
 
 		~FGraphBuilder()
@@ -725,9 +921,14 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		}
 	};
 
+	/**
+	 * Builds a flat endpoints lookup : one H64(EndpointId, PointIndex) entry per vtx, sorted.
+	 * Ids resolve through a binary search over contiguous memory (see FindEndpoint) and the lookup
+	 * can be shared read-only by every cluster built from these vtx.
+	 */
 	static bool BuildEndpointsLookup(
 		const TSharedPtr<PCGExData::FPointIO>& InPointIO,
-		TMap<uint32, int32>& OutIndices,
+		TArray<uint64>& OutIndices,
 		TArray<int32>& OutAdjacency)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExGraph::BuildLookupTable);
@@ -738,19 +939,21 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		const TUniquePtr<PCGExData::TBuffer<int64>> IndexBuffer = MakeUnique<PCGExData::TBuffer<int64>>(InPointIO.ToSharedRef(), Tag_VtxEndpoint);
 		if (!IndexBuffer->PrepareRead()) { return false; }
 
-		const TArray<int64>& Indices = *IndexBuffer->GetInValues().Get();
+		const PCGExData::TColumn<int64>& Indices = *IndexBuffer->GetInValues().Get();
 
-		OutIndices.Reserve(Indices.Num());
+		PCGEx::InitArray(OutIndices, Indices.Num());
 		for (int i = 0; i < Indices.Num(); i++)
 		{
 			uint32 A;
 			uint32 B;
 			PCGEx::H64(Indices[i], A, B);
 
-			OutIndices.Add(A, i);
+			OutIndices[i] = PCGEx::H64(A, i);
 			OutAdjacency[i] = B;
 		}
 
+		OutIndices.Sort();
+
 		return true;
 	}
 
@@ -144,52 +144,73 @@ namespace PCGExGraph
 {
 #pragma region Compound Graph
 
-	class /*PCGEXTENDEDTOOLKIT_API*/ FUnionNode : public TSharedFromThis<FUnionNode>
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FUnionNode
 	{
-	protected:
-		mutable FRWLock AdjacencyLock;
-
-	public:
-		const FPCGPoint Point;
-		FVector Center;
-		FBoxSphereBounds Bounds;
-		int32 Index;
+		FPCGPoint Point;
+		FVector Center = FVector::ZeroVector;
+		FBoxSphereBounds Bounds = FBoxSphereBounds(ForceInit);
+		int32 Index = -1;
 
-		TSet<int32> Adjacency;
+		FUnionNode() = default;
 
 		FUnionNode(const FPCGPoint& InPoint, const FVector& InCenter, const int32 InIndex)
 			: Point(InPoint),
 			  Center(InCenter),
 			  Index(InIndex)
 		{
-			Adjacency.Empty();
 			Bounds = FBoxSphereBounds(InPoint.GetLocalBounds().TransformBy(InPoint.Transform));
 		}
 
-		~FUnionNode()
-		{
-			Adjacency.Empty();
-		}
-
 		FVector UpdateCenter(const TSharedPtr<PCGExData::FUnionMetadata>& InUnionMetadata, const TSharedPtr<PCGExData::FPointIOCollection>& IOGroup);
+	};
 
-		FORCEINLINE void Add(const int32 InAdjacency)
+	PCGEX_OCTREE_SEMANTICS_REF(FUnionNode, { return Element.Bounds;}, { return A.Index == B.Index; })
+
+	/** A single (IOIndex, ItemIndex) contribution to a union node or edge, recorded at insertion time */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FUnionItem
+	{
+		int32 Index = -1;
+		int32 IOIndex = -1;
+		int32 ItemIndex = -1;
+
+		FUnionItem() = default;
+
+		FUnionItem(const int32 InIndex, const int32 InIOIndex, const int32 InItemIndex)
+			: Index(InIndex), IOIndex(InIOIndex), ItemIndex(InItemIndex)
 		{
-			FWriteScopeLock WriteScopeLock(AdjacencyLock);
-			Adjacency.Add(InAdjacency);
 		}
 	};
 
-	PCGEX_OCTREE_SEMANTICS(FUnionNode, { return Element->Bounds;}, { return A->Index == B->Index; })
+	/**
+	 * One slice of the union graph insertion state.
+	 * Keys are spread across shards so concurrent inserts only contend when they land in the same shard.
+	 * Nodes, edges and union contributions are buffered here and merged once by FUnionGraph::Finalize.
+	 */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FUnionShard
+	{
+		mutable FRWLock Lock;
+
+		TMap<uint32, int32> GridCells; // Grid key -> local node index
+		TArray<FUnionNode> Nodes;
+		TArray<FUnionItem> NodeItems;
+
+		TMap<uint64, int32> EdgeMap; // Edge hash -> local edge index
+		TArray<FEdge> Edges;
+		TArray<int32> EdgeUnionSizes;
+		TArray<FUnionItem> EdgeItems;
+	};
 
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FUnionGraph
 	{
-		TMap<uint32, TSharedPtr<FUnionNode>> GridTree;
+		static constexpr int32 ShardBits = 6;
+		static constexpr int32 NumShards = 1 << ShardBits;
 
 		TSharedPtr<PCGExData::FUnionMetadata> NodesUnion;
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion;
-		TArray<TSharedPtr<FUnionNode>> Nodes;
-		TMap<uint64, FEdge> Edges;
+
+		// Only valid once Finalize has been called
+		TArray<FUnionNode> Nodes;
+		TArray<FEdge> Edges;
 
 		FPCGExFuseDetails FuseDetails;
 
@@ -197,8 +218,7 @@ namespace PCGExGraph
 
 		TUniquePtr<FUnionNodeOctree> Octree;
 
-		mutable FRWLock UnionLock;
-		mutable FRWLock EdgesLock;
+		mutable FRWLock UnionLock; // Only guards the octree
 
 		explicit FUnionGraph(const FPCGExFuseDetails& InFuseDetails, const FBox& InBounds)
 			: FuseDetails(InFuseDetails),
@@ -219,21 +239,44 @@ namespace PCGExGraph
 		{
 		}
 
-		int32 NumNodes() const { return NodesUnion->Num(); }
-		int32 NumEdges() const { return EdgesUnion->Num(); }
-
-		TSharedPtr<FUnionNode> InsertPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
-		TSharedPtr<FUnionNode> InsertPointUnsafe(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
-		TSharedPtr<PCGExData::FUnionData> InsertEdge(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex,
-		                                             const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex,
-		                                             const int32 EdgeIOIndex = -1, const int32 EdgePointIndex = -1);
-		TSharedPtr<PCGExData::FUnionData> InsertEdgeUnsafe(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex,
-		                                                   const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex,
-		                                                   const int32 EdgeIOIndex = -1, const int32 EdgePointIndex = -1);
+		int32 NumNodes() const { return NodeCounter.load(std::memory_order_relaxed); }
+		int32 NumEdges() const { return EdgeCounter.load(std::memory_order_relaxed); }
+
+		/** Returns the index of the union node the point was fused into */
+		int32 InsertPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
+		int32 InsertPointUnsafe(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
+
+		/** Returns the index of the union edge, or -1 if both ends got fused together */
+		int32 InsertEdge(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex,
+		                 const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex,
+		                 const int32 EdgeIOIndex = -1, const int32 EdgePointIndex = -1);
+		int32 InsertEdgeUnsafe(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex,
+		                       const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex,
+		                       const int32 EdgeIOIndex = -1, const int32 EdgePointIndex = -1);
+
+		/** Merges shard buffers into Nodes, Edges & union metadata. Must be called once all insertions are done. */
+		void Finalize();
+
 		void GetUniqueEdges(TSet<uint64>& OutEdges);
 		void GetUniqueEdges(TArray<FEdge>& OutEdges);
 		void WriteNodeMetadata(const TSharedPtr<FGraph>& InGraph) const;
 		void WriteEdgeMetadata(const TSharedPtr<FGraph>& InGraph) const;
+
+	protected:
+		FUnionShard Shards[NumShards];
+		std::atomic<int32> NodeCounter{0};
+		std::atomic<int32> EdgeCounter{0};
+		bool bFinalized = false;
+
+		FORCEINLINE static int32 GetShardIndex(const uint32 Hash) { return static_cast<int32>((Hash * 2654435761u) >> (32 - ShardBits)); }
+
+		template <bool bThreadSafe>
+		int32 InsertPointInternal(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
+
+		template <bool bThreadSafe>
+		int32 InsertEdgeInternal(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex,
+		                         const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex,
+		                         const int32 EdgeIOIndex, const int32 EdgePointIndex);
 	};
 
 #pragma endregion
@@ -360,7 +403,7 @@ namespace PCGExGraph
 		if (!InIntersections->Details->bEnableSelfIntersection)
 		{
 			const int32 RootIndex = InIntersections->Graph->FindEdgeMetadataUnsafe(Edge.EdgeIndex)->RootIndex;
-			const TSet<int32>& RootIOIndices = Graph->EdgesUnion->Entries[RootIndex]->IOIndices;
+			const TConstArrayView<uint64> RootItems = Graph->EdgesUnion->Get(RootIndex);
 
 			auto ProcessPointRef = [&](const FPCGPointRef& PointRef)
 			{
@@ -377,7 +420,7 @@ namespace PCGExGraph
 				if (IEdge.Start == Node.PointIndex || IEdge.End == Node.PointIndex) { return; }
 				if (!Edge.FindSplit(Position, Split)) { return; }
 
-				if (Graph->NodesUnion->IOIndexOverlap(Node.Index, RootIOIndices)) { return; }
+				if (Graph->NodesUnion->IOIndexOverlap(Node.Index, RootItems)) { return; }
 
 				Split.NodeIndex = Node.Index;
 				InIntersections->Add(EdgeIndex, Split);
@@ -604,7 +647,7 @@ namespace PCGExGraph
 		{
 			const int32 RootIndex = InIntersections->Graph->FindEdgeMetadataUnsafe(Edge.EdgeIndex)->RootIndex;
 			TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion = InIntersections->Graph->EdgesUnion;
-			const TSet<int32>& RootIOIndices = EdgesUnion->Entries[RootIndex]->IOIndices;
+			const TConstArrayView<uint64> RootItems = EdgesUnion->Get(RootIndex);
 
 			auto ProcessEdge = [&](const FEdgeEdgeProxy* Proxy)
 			{
@@ -618,7 +661,7 @@ namespace PCGExGraph
 				}
 
 				// Check overlap last as it's the most expensive op
-				if (EdgesUnion->IOIndexOverlap(InIntersections->Graph->FindEdgeMetadataUnsafe(OtherEdge.EdgeIndex)->RootIndex, RootIOIndices)) { return; }
+				if (EdgesUnion->IOIndexOverlap(InIntersections->Graph->FindEdgeMetadataUnsafe(OtherEdge.EdgeIndex)->RootIndex, RootItems)) { return; }
 
 				if (!Edge.FindSplit(OtherEdge, OutSplits))
 				{
@@ -44,6 +44,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExHeuristicAttribute : public UPCGExHeurist
 
 public:
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster) override;
+	virtual bool IsStatic() const override { return true; }
 
 	FORCEINLINE virtual double GetEdgeScore(
 		const PCGExCluster::FNode& From,
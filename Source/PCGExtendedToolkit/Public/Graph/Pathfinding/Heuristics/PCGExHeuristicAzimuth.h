@@ -33,6 +33,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExHeuristicAzimuth : public UPCGExHeuristic
 
 public:
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster) override;
+	virtual bool IsGoalDependent() const override { return true; }
 
 	FORCEINLINE virtual double GetGlobalScore(
 		const PCGExCluster::FNode& From,
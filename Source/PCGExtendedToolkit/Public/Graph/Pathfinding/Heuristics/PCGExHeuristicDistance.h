@@ -33,6 +33,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExHeuristicDistance : public UPCGExHeuristi
 
 public:
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster) override;
+	virtual bool IsStatic() const override { return true; }
 
 	FORCEINLINE virtual double GetGlobalScore(
 		const PCGExCluster::FNode& From,
@@ -35,6 +35,12 @@ public:
 
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster);
 
+	/** Whether GetEdgeScore depends on the query goal. If so, a search tree cannot be shared between goals. */
+	virtual bool IsGoalDependent() const { return false; }
+
+	/** Whether GetEdgeScore only depends on the edge & its direction. Static scores are baked once per cluster. */
+	virtual bool IsStatic() const { return false; }
+
 	FORCEINLINE virtual double GetGlobalScore(
 		const PCGExCluster::FNode& From,
 		const PCGExCluster::FNode& Seed,
@@ -43,6 +43,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExHeuristicSteepness : public UPCGExHeurist
 
 public:
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster) override;
+	virtual bool IsStatic() const override { return true; }
 
 	FORCEINLINE virtual double GetGlobalScore(
 		const PCGExCluster::FNode& From,
@@ -87,6 +87,7 @@ namespace PCGExHeuristics
 		TSharedPtr<PCGExData::FFacade> EdgeDataFacade;
 
 		TArray<UPCGExHeuristicOperation*> Operations;
+		TArray<UPCGExHeuristicOperation*> DynamicOperations; // Operations that must be evaluated on a per-query basis
 		TArray<UPCGExHeuristicFeedback*> Feedbacks;
 		TArray<TObjectPtr<const UPCGExHeuristicsFactoryBase>> LocalFeedbackFactories;
 
@@ -95,12 +96,20 @@ namespace PCGExHeuristics
 		double ReferenceWeight = 1;
 		double TotalStaticWeight = 0;
 		bool bUseDynamicWeight = false;
+		bool bHasGoalDependentEdgeScore = false;
+
+		// Baked per-cluster values, two entries per edge (Start->End, End->Start)
+		TArray<double> StaticEdgeScores;
+		TArray<double> EdgeWeights;
 
 		bool IsValidHandler() const { return bIsValidHandler; }
 		bool HasGlobalFeedback() const { return !Feedbacks.IsEmpty(); };
 		bool HasLocalFeedback() const { return !LocalFeedbackFactories.IsEmpty(); };
 		bool HasAnyFeedback() const { return HasGlobalFeedback() || HasLocalFeedback(); };
 
+		/** Whether edge scores are independent from both the goal and previous queries, so that a single search tree can serve many goals */
+		bool CanShareSearchTree() const { return !bHasGoalDependentEdgeScore && !HasAnyFeedback(); };
+
 		FHeuristicsHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryBase>>& InFactories);
 		~FHeuristicsHandler();
 
@@ -109,6 +118,18 @@ namespace PCGExHeuristics
 		void CompleteClusterPreparation();
 
 
+		FORCEINLINE static int32 GetEdgeSlot(const PCGExCluster::FNode& From, const PCGExGraph::FEdge& Edge)
+		{
+			return Edge.Index * 2 + (static_cast<uint32>(From.PointIndex) == Edge.Start ? 0 : 1);
+		}
+
+		FORCEINLINE double GetEdgeWeight(const PCGExCluster::FNode& To, const PCGExGraph::FEdge& Edge) const
+		{
+			double EWeight = 0;
+			for (const UPCGExHeuristicOperation* Op : Operations) { EWeight += (Op->WeightFactor * Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex)); }
+			return EWeight;
+		}
+
 		FORCEINLINE double GetGlobalScore(
 			const PCGExCluster::FNode& From,
 			const PCGExCluster::FNode& Seed,
@@ -136,12 +157,14 @@ namespace PCGExHeuristics
 			const FLocalFeedbackHandler* LocalFeedback = nullptr,
 			const TSharedPtr<PCGEx::FHashLookup> TravelStack = nullptr) const
 		{
-			double EScore = 0;
-			double EWeight = TotalStaticWeight;
+			const int32 Slot = GetEdgeSlot(From, Edge);
+
+			double EScore = StaticEdgeScores.IsEmpty() ? 0 : StaticEdgeScores[Slot];
+			for (const UPCGExHeuristicOperation* Op : DynamicOperations) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
 
 			if (!bUseDynamicWeight)
 			{
-				for (const UPCGExHeuristicOperation* Op : Operations) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
+				double EWeight = TotalStaticWeight;
 
 				if (LocalFeedback)
 				{
@@ -152,21 +175,13 @@ namespace PCGExHeuristics
 				return EScore / EWeight;
 			}
 
-			EWeight = 0;
-
-			for (const UPCGExHeuristicOperation* Op : Operations)
-			{
-				EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack);
-				EWeight += (Op->WeightFactor * Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex));
-			}
-
 			if (LocalFeedback)
 			{
 				EScore += LocalFeedback->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack);
 				//EWeight += LocalFeedback->TotalStaticWeight;
 			}
 
-			return EScore / EWeight;
+			return EScore / (EdgeWeights.IsEmpty() ? GetEdgeWeight(To, Edge) : EdgeWeights[Slot]);
 		}
 
 		FORCEINLINE void FeedbackPointScore(const PCGExCluster::FNode& Node)
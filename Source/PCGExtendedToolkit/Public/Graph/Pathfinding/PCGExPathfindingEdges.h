@@ -97,6 +97,10 @@ public:
 	/** Whether or not to search for closest node using an octree. Depending on your dataset, enabling this may be either much faster, or slightly slower. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bUseOctreeSearch = false;
+
+	/** When a seed has multiple goals, resolve all of them from a single shortest-path tree instead of running one search per goal. Only used by Dijkstra, with heuristics that don't depend on the goal and have no feedback. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bBatchQueriesPerSeed = true;
 };
 
 
@@ -142,6 +146,9 @@ namespace PCGExPathfindingEdge
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExPathfindingEdgesContext, UPCGExPathfindingEdgesSettings>
 	{
 		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> Queries;
+		TArray<int32> SeedGroups; // Start index of each run of queries sharing the same seed
+
+		void ResolveSeedGroup(const int32 GroupIndex);
 
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade):
@@ -107,13 +107,14 @@ namespace PCGExFindAllCells
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExFindAllCellsContext, UPCGExFindAllCellsSettings>
 	{
 		friend class FBatch;
-		int32 NumAttempts = 0;
-		int32 LastBinary = -1;
 
 	protected:
 		bool bBuildExpandedNodes = false;
 		TSharedPtr<PCGExTopology::FCell> WrapperCell;
 
+		TSharedPtr<PCGExTopology::FPlanarFaces> PlanarFaces;
+		TArray<int32> FaceSeeds; // One seed half-edge per face worth walking
+
 	public:
 		TSharedPtr<PCGExTopology::FCellConstraints> CellsConstraints;
 
@@ -127,11 +128,8 @@ namespace PCGExFindAllCells
 		virtual ~FProcessor() override;
 
 		virtual bool Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
-		virtual void ProcessSingleEdge(const int32 EdgeIndex, PCGExGraph::FEdge& Edge, const PCGExMT::FScope& Scope) override;
-		bool FindCell(const PCGExCluster::FNode& Node, const PCGExGraph::FEdge& Edge, const bool bSkipBinary = true);
+		bool FindCell(const int32 HalfEdge);
 		void ProcessCell(const TSharedPtr<PCGExTopology::FCell>& InCell) const;
-		void EnsureRoamingClosedLoopProcessing();
-		virtual void OnEdgesProcessingComplete() override;
 		virtual void CompleteWork() override;
 		virtual void Cleanup() override;
 	};
@@ -3,13 +3,20 @@
 
 #pragma once
 
-#include <queue>
-#include <vector>
+#include "CoreMinimal.h"
+#include "PCGExMacros.h"
 
 namespace PCGExSearch
 {
+	/**
+	 * Indexed d-ary min-heap with decrease-key.
+	 * Each item lives in the heap at most once; improving its score sifts it up in place
+	 * instead of pushing a duplicate, so the heap never grows beyond the number of items.
+	 */
 	class FScoredQueue
 	{
+		static constexpr int32 Arity = 4;
+
 		struct FScoredNode
 		{
 			int32 Id;
@@ -20,42 +27,117 @@ namespace PCGExSearch
 				: Id(InItem), Score(InScore)
 			{
 			}
+		};
 
-			/** Creates and initializes a new node. */
-			explicit FScoredNode(int32&& InItem, const double InScore)
-				: Id(MoveTemp(InItem)), Score(InScore)
+	protected:
+		TArray<FScoredNode> Heap;
+
+		// Scores & positions are only valid when their stamp matches the current generation,
+		// which allows the queue to be reset without touching every entry.
+		TArray<double> Scores;
+		TArray<int32> Positions; // Position in the heap, -1 once dequeued
+		TArray<uint32> Stamps;
+		uint32 Generation = 1;
+
+		FORCEINLINE void Place(const int32 At, const FScoredNode& Node)
+		{
+			Heap[At] = Node;
+			Positions[Node.Id] = At;
+		}
+
+		FORCEINLINE void SiftUp(int32 At, const FScoredNode& Node)
+		{
+			while (At > 0)
 			{
+				const int32 Parent = (At - 1) / Arity;
+				if (Heap[Parent].Score <= Node.Score) { break; }
+				Place(At, Heap[Parent]);
+				At = Parent;
 			}
 
-			bool operator<(const FScoredNode& Other) const { return Score < Other.Score; }
-			bool operator>(const FScoredNode& Other) const { return Score > Other.Score; }
-		};
+			Place(At, Node);
+		}
 
-	protected:
-		std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> InternalQueue;
+		FORCEINLINE void SiftDown(int32 At, const FScoredNode& Node)
+		{
+			const int32 Num = Heap.Num();
+
+			while (true)
+			{
+				const int32 FirstChild = At * Arity + 1;
+				if (FirstChild >= Num) { break; }
+
+				const int32 LastChild = FMath::Min(FirstChild + Arity, Num);
+				int32 Best = FirstChild;
+				for (int32 i = FirstChild + 1; i < LastChild; i++) { if (Heap[i].Score < Heap[Best].Score) { Best = i; } }
+
+				if (Node.Score <= Heap[Best].Score) { break; }
+				Place(At, Heap[Best]);
+				At = Best;
+			}
+
+			Place(At, Node);
+		}
 
 	public:
-		TArray<double> Scores;
+		explicit FScoredQueue(const int32 Size)
+		{
+			Scores.SetNumUninitialized(Size);
+			Positions.SetNumUninitialized(Size);
+			Stamps.Init(0, Size);
+		}
 
 		FScoredQueue(const int32 Size, const int32& Item, const double Score)
+			: FScoredQueue(Size)
 		{
-			Scores.Init(MAX_dbl, Size);
 			Enqueue(Item, Score);
 		}
 
-		~FScoredQueue()
+		~FScoredQueue() = default;
+
+		FORCEINLINE void Reset()
 		{
-			std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> EmptyQueue;
-			std::swap(InternalQueue, EmptyQueue);
+			Heap.Reset();
+			if (++Generation == 0)
+			{
+				FMemory::Memzero(Stamps.GetData(), Stamps.Num() * sizeof(uint32));
+				Generation = 1;
+			}
+		}
+
+		FORCEINLINE void Reset(const int32 Item, const double Score)
+		{
+			Reset();
+			Enqueue(Item, Score);
 		}
 
+		FORCEINLINE bool IsEmpty() const { return Heap.IsEmpty(); }
+
+		FORCEINLINE double GetScore(const int32 Index) const { return Stamps[Index] == Generation ? Scores[Index] : MAX_dbl; }
+
 		FORCEINLINE bool Enqueue(const int32 Index, const double InScore)
 		{
-			double& RegisteredScore = Scores[Index];
-			if (RegisteredScore <= InScore) { return false; }
+			if (Stamps[Index] != Generation)
+			{
+				Stamps[Index] = Generation;
+			}
+			else
+			{
+				if (Scores[Index] <= InScore) { return false; }
 
-			RegisteredScore = InScore;
-			InternalQueue.push(FScoredNode(Index, InScore));
+				if (const int32 Position = Positions[Index]; Position != -1)
+				{
+					// Decrease-key
+					Scores[Index] = InScore;
+					SiftUp(Position, FScoredNode(Index, InScore));
+					return true;
+				}
+			}
+
+			// New item, or an item that was already dequeued and is reinserted with a better score
+			Scores[Index] = InScore;
+			Heap.Emplace(Index, InScore);
+			SiftUp(Heap.Num() - 1, FScoredNode(Index, InScore));
 			return true;
 		}
 
@@ -63,20 +145,22 @@ namespace PCGExSearch
 		{
 			//TRACE_CPUPROFILER_EVENT_SCOPE(ScoredQueue::Dequeue);
 
-			while (!InternalQueue.empty())
-			{
-				const FScoredNode TopNode = InternalQueue.top();
-				InternalQueue.pop();
+			if (Heap.IsEmpty()) { return false; }
 
-				if (TopNode.Score == Scores[TopNode.Id])
-				{
-					Item = TopNode.Id;
-					OutScore = TopNode.Score;
-					return true;
-				}
-			}
+			const FScoredNode Top = Heap[0];
+			Positions[Top.Id] = -1;
 
-			return false;
+#if PCGEX_ENGINE_VERSION <= 503
+			const FScoredNode LastNode = Heap.Pop(false);
+#else
+			const FScoredNode LastNode = Heap.Pop(EAllowShrinking::No);
+#endif
+
+			if (!Heap.IsEmpty()) { SiftDown(0, LastNode); }
+
+			Item = Top.Id;
+			OutScore = Top.Score;
+			return true;
 		}
 	};
 }
@@ -27,6 +27,8 @@ public:
 		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback) const override;
 
+	virtual bool SupportsBatchedQueries(const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics) const override;
+
 	/** Early exit */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bEarlyExit = true;
@@ -9,6 +9,7 @@
 
 #include "Graph/PCGExCluster.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+#include "Graph/Pathfinding/Search/PCGExSearchWorkspace.h"
 #include "UObject/Object.h"
 #include "PCGExSearchOperation.generated.h"
 
@@ -35,10 +36,28 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExSearchOperation : public UPCGExOperation
 public:
 	PCGExCluster::FCluster* Cluster = nullptr;
 
+	// Reusable per-thread search workspaces, sized for the current cluster
+	TSharedPtr<PCGExSearch::FSearchWorkspacePool> WorkspacePool;
+
 	virtual void CopySettingsFrom(const UPCGExOperation* Other) override;
 
 	virtual void PrepareForCluster(PCGExCluster::FCluster* InCluster);
 	virtual bool ResolveQuery(
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics, const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const;
+
+	/**
+	 * Whether queries sharing a seed can be resolved from a single shortest-path tree with the given heuristics.
+	 * Only searches that would grow that exact tree on their own should opt in, so batching never changes the resulting paths.
+	 */
+	virtual bool SupportsBatchedQueries(const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics) const;
+
+	/**
+	 * Resolve a batch of queries sharing the same seed node by growing a single shortest-path tree
+	 * until every goal is settled, then walking it back for each goal.
+	 * Queries must have successfully resolved their picks. Resolution is set on each query.
+	 */
+	virtual void ResolveBatchedQueries(
+		const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>& InQueries,
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics) const;
 };
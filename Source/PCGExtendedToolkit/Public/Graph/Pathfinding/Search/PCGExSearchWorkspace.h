@@ -0,0 +1,162 @@
+﻿// Copyright 2024 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "PCGExH.h"
+#include "PCGExScoredQueue.h"
+
+namespace PCGExSearch
+{
+	/**
+	 * Travel stack whose entries are invalidated by bumping a generation counter,
+	 * rather than re-initializing the whole array between queries.
+	 */
+	class FTravelStack final : public PCGEx::FHashLookup
+	{
+	protected:
+		TArray<uint64> Data;
+		TArray<uint32> Stamps;
+		uint32 Generation = 1;
+
+	public:
+		explicit FTravelStack(const uint64 InitValue, const int32 Size)
+			: FHashLookup(InitValue, Size)
+		{
+			Data.SetNumUninitialized(Size);
+			Stamps.Init(0, Size);
+		}
+
+		FORCEINLINE virtual void Set(const int32 At, const uint64 Value) override
+		{
+			Data[At] = Value;
+			Stamps[At] = Generation;
+		}
+
+		FORCEINLINE virtual uint64 Get(const int32 At) override { return Stamps[At] == Generation ? Data[At] : InternalInitValue; }
+
+		FORCEINLINE void Reset()
+		{
+			if (++Generation == 0)
+			{
+				FMemory::Memzero(Stamps.GetData(), Stamps.Num() * sizeof(uint32));
+				Generation = 1;
+			}
+		}
+	};
+
+	/**
+	 * Per-thread search state (visited set, scores, travel stack & queue) sized for a cluster.
+	 * Reset is O(1); per-query cost scales with the number of visited nodes, not the cluster size.
+	 */
+	class FSearchWorkspace : public TSharedFromThis<FSearchWorkspace>
+	{
+	protected:
+		TArray<uint32> VisitedStamps;
+		TArray<uint32> ScoreStamps;
+		TArray<double> GScores;
+		uint32 Generation = 1;
+
+	public:
+		const int32 NumNodes;
+
+		TSharedPtr<FTravelStack> TravelStack;
+		TUniquePtr<FScoredQueue> ScoredQueue;
+
+		explicit FSearchWorkspace(const int32 InNumNodes)
+			: NumNodes(InNumNodes)
+		{
+			VisitedStamps.Init(0, NumNodes);
+			ScoreStamps.Init(0, NumNodes);
+			GScores.SetNumUninitialized(NumNodes);
+
+			TravelStack = MakeShared<FTravelStack>(PCGEx::NH64(-1, -1), NumNodes);
+			ScoredQueue = MakeUnique<FScoredQueue>(NumNodes);
+		}
+
+		~FSearchWorkspace() = default;
+
+		FORCEINLINE void Reset()
+		{
+			if (++Generation == 0)
+			{
+				FMemory::Memzero(VisitedStamps.GetData(), VisitedStamps.Num() * sizeof(uint32));
+				FMemory::Memzero(ScoreStamps.GetData(), ScoreStamps.Num() * sizeof(uint32));
+				Generation = 1;
+			}
+
+			TravelStack->Reset();
+			ScoredQueue->Reset();
+		}
+
+		FORCEINLINE bool IsVisited(const int32 Index) const { return VisitedStamps[Index] == Generation; }
+		FORCEINLINE void SetVisited(const int32 Index) { VisitedStamps[Index] = Generation; }
+
+		/** Returns -1 if the node has no score yet */
+		FORCEINLINE double GetGScore(const int32 Index) const { return ScoreStamps[Index] == Generation ? GScores[Index] : -1; }
+
+		FORCEINLINE void SetGScore(const int32 Index, const double Score)
+		{
+			GScores[Index] = Score;
+			ScoreStamps[Index] = Generation;
+		}
+	};
+
+	/**
+	 * Thread-safe pool of workspaces for a given cluster.
+	 * At most one workspace is created per concurrently running query.
+	 */
+	class FSearchWorkspacePool : public TSharedFromThis<FSearchWorkspacePool>
+	{
+		mutable FRWLock PoolLock;
+		TArray<TSharedPtr<FSearchWorkspace>> Available;
+
+	public:
+		const int32 NumNodes;
+
+		explicit FSearchWorkspacePool(const int32 InNumNodes)
+			: NumNodes(InNumNodes)
+		{
+		}
+
+		TSharedPtr<FSearchWorkspace> Acquire()
+		{
+			TSharedPtr<FSearchWorkspace> Workspace;
+
+			{
+				FWriteScopeLock WriteScopeLock(PoolLock);
+				if (!Available.IsEmpty()) { Workspace = Available.Pop(); }
+			}
+
+			if (!Workspace) { return MakeShared<FSearchWorkspace>(NumNodes); }
+
+			Workspace->Reset();
+			return Workspace;
+		}
+
+		void Release(const TSharedPtr<FSearchWorkspace>& InWorkspace)
+		{
+			if (!InWorkspace) { return; }
+			FWriteScopeLock WriteScopeLock(PoolLock);
+			Available.Add(InWorkspace);
+		}
+	};
+
+	/** Acquires a workspace from a pool for the duration of a scope */
+	struct FScopedWorkspace
+	{
+		TSharedPtr<FSearchWorkspacePool> Pool;
+		TSharedPtr<FSearchWorkspace> Workspace;
+
+		explicit FScopedWorkspace(const TSharedPtr<FSearchWorkspacePool>& InPool)
+			: Pool(InPool), Workspace(InPool->Acquire())
+		{
+		}
+
+		~FScopedWorkspace() { Pool->Release(Workspace); }
+
+		FORCEINLINE FSearchWorkspace* operator->() const { return Workspace.Get(); }
+	};
+}
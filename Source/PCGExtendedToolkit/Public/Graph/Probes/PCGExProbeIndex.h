@@ -61,7 +61,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExProbeIndex : public UPCGExProbeOperation
 public:
 	virtual bool RequiresDirectProcessing() override;
 	virtual bool PrepareForPoints(const TSharedPtr<PCGExData::FPointIO>& InPointIO) override;
-	FORCEINLINE virtual void ProcessNode(const int32 Index, const FPCGPoint& Point, TSet<FInt32Vector>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges) override
+	FORCEINLINE virtual void ProcessNode(const int32 Index, const FPCGPoint& Point, TSet<FInt32Vector>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges) override
 	{
 		TryCreateEdge(Index, OutEdges);
 	}
@@ -75,7 +75,7 @@ public:
 	FPCGExProbeConfigIndex Config;
 	TSharedPtr<PCGExData::TBuffer<int32>> TargetCache;
 
-	using TryCreateEdgeCallback = std::function<void(const int32, TSet<uint64>*)>;
+	using TryCreateEdgeCallback = std::function<void(const int32, TArray<uint64>*)>;
 	TryCreateEdgeCallback TryCreateEdge;
 
 protected:
@@ -82,11 +82,11 @@ namespace PCGExClusterStates
 	class /*PCGEXTENDEDTOOLKIT_API*/ FStateManager final : public PCGExClusterFilter::FManager
 	{
 		TArray<TSharedPtr<FState>> States;
-		TSharedPtr<TArray<int64>> FlagsCache;
+		TSharedPtr<PCGExData::TColumn<int64>> FlagsCache;
 
 	public:
 		explicit FStateManager(
-			const TSharedPtr<TArray<int64>>& InFlags,
+			const TSharedPtr<PCGExData::TColumn<int64>>& InFlags,
 			const TSharedRef<PCGExCluster::FCluster>& InCluster,
 			const TSharedRef<PCGExData::FFacade>& InPointDataCache,
 			const TSharedRef<PCGExData::FFacade>& InEdgeDataCache);
@@ -112,6 +112,12 @@ namespace PCGExClusterStates
 			return true;
 		}
 
+		virtual void TestScope(const PCGExMT::FScope& Scope, TArray<int8>& OutResults) override
+		{
+			// States write flags as they go, keep them on the per-index path
+			for (int i = Scope.Start; i < Scope.End; i++) { OutResults[i] = Test(i); }
+		}
+
 	protected:
 		virtual void PostInitFilter(FPCGExContext* InContext, const TSharedPtr<PCGExPointFilter::FFilter>& InFilter) override;
 	};
@@ -73,7 +73,7 @@ namespace PCGExFlagNodes
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExFlagNodesContext, UPCGExFlagNodesSettings>
 	{
 		friend class FBatch;
-		TSharedPtr<TArray<int64>> StateFlags;
+		TSharedPtr<PCGExData::TColumn<int64>> StateFlags;
 		TSharedPtr<PCGExClusterStates::FStateManager> StateManager;
 
 	public:
@@ -92,7 +92,7 @@ namespace PCGExFlagNodes
 
 	class FBatch final : public PCGExClusterMT::TBatch<FProcessor>
 	{
-		TSharedPtr<TArray<int64>> StateFlags;
+		TSharedPtr<PCGExData::TColumn<int64>> StateFlags;
 
 	public:
 		FBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges)
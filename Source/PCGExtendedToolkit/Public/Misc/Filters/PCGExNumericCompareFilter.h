@@ -89,6 +89,28 @@ namespace PCGExPointsFilter
 			return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 		}
 
+		virtual void TestScope(const PCGExMT::FScope& Scope, TBitArray<>& OutResults) const override;
+
+	protected:
+		template <typename FCompare>
+		FORCEINLINE void PackCompare(const PCGExMT::FScope& Scope, TBitArray<>& OutResults, FCompare&& InCompare) const
+		{
+			const double* A = OperandA->GetInValues()->GetData();
+
+			if (OperandB)
+			{
+				const double* B = OperandB->GetInValues()->GetData();
+				PCGExPointFilter::PackScope(Scope, OutResults, [&](const int32 Index) { return InCompare(A[Index], B[Index]); });
+			}
+			else
+			{
+				const double B = TypedFilterFactory->Config.OperandBConstant;
+				PCGExPointFilter::PackScope(Scope, OutResults, [&](const int32 Index) { return InCompare(A[Index], B); });
+			}
+		}
+
+	public:
+
 		virtual ~TNumericComparisonFilter() override
 		{
 		}
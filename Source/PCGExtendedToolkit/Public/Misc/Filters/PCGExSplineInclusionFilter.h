@@ -84,6 +84,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExSplineInclusionFilterFactory : public UPC
 public:
 	FPCGExSplineInclusionFilterConfig Config;
 	TArray<FPCGSplineStruct> Splines;
+	TSharedPtr<PCGExPaths::FSplineIndex> SplineIndex;
 	virtual bool Init(FPCGExContext* InContext) override;
 	virtual TSharedPtr<PCGExPointFilter::FFilter> CreateFilter() const override;
 
@@ -114,11 +115,13 @@ namespace PCGExPointsFilter
 			: FSimpleFilter(InFactory), TypedFilterFactory(InFactory)
 		{
 			Splines = &TypedFilterFactory->Splines;
+			SplineIndex = TypedFilterFactory->SplineIndex.Get();
 		}
 
 		const TObjectPtr<const UPCGExSplineInclusionFilterFactory> TypedFilterFactory;
 
 		const TArray<FPCGSplineStruct>* Splines = nullptr;
+		const PCGExPaths::FSplineIndex* SplineIndex = nullptr;
 
 		double ToleranceSquared = MAX_dbl;
 		ESplineCheckFlags GoodFlags = None;
@@ -8,6 +8,7 @@
 #include "PCGExGlobalSettings.h"
 
 #include "PCGExPointsProcessor.h"
+#include "Geometry/PCGExGeoDelaunay.h"
 
 
 #include "PCGExLloydRelax.generated.h"
@@ -40,6 +41,11 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=1))
 	int32 Iterations = 5;
 
+	/** Keep the previous iteration's triangulation as long as it is still valid for the relaxed positions, instead of rebuilding it every iteration.
+	 * Points move less and less as relaxation converges, so later iterations mostly skip triangulation entirely. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta = (PCG_NotOverridable, AdvancedDisplay))
+	bool bReuseTriangulation = true;
+
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
@@ -72,6 +78,12 @@ namespace PCGExLloydRelax
 		FPCGExInfluenceDetails InfluenceDetails;
 		TArray<FVector> ActivePositions;
 
+		TUniquePtr<PCGExGeo::TDelaunay3> Delaunay;
+		TArray<int32> SiteOffsets; // Per point, range in PointSites
+		TArray<int32> PointSites;  // Sites using each point, in ascending order
+		TArray<FVector> Centroids;
+		int32 RemainingIterations = 0;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
@@ -79,6 +91,10 @@ namespace PCGExLloydRelax
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
+		void StartIteration();
+		bool UpdateTriangulation();
+		void ComputeCentroids();
+		void ApplyCentroids();
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
 	};
@@ -87,19 +103,13 @@ namespace PCGExLloydRelax
 	{
 	public:
 		FLloydRelaxTask(const int32 InTaskIndex,
-		                const TSharedPtr<FProcessor>& InProcessor,
-		                const FPCGExInfluenceDetails* InInfluenceSettings,
-		                const int32 InNumIterations) :
+		                const TSharedPtr<FProcessor>& InProcessor) :
 			FPCGExIndexedTask(InTaskIndex),
-			Processor(InProcessor),
-			InfluenceSettings(InInfluenceSettings),
-			NumIterations(InNumIterations)
+			Processor(InProcessor)
 		{
 		}
 
 		TSharedPtr<FProcessor> Processor;
-		const FPCGExInfluenceDetails* InfluenceSettings = nullptr;
-		int32 NumIterations = 0;
 
 		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override;
 	};
@@ -11,6 +11,7 @@
 
 
 #include "Geometry/PCGExGeo.h"
+#include "Geometry/PCGExGeoDelaunay.h"
 #include "PCGExLloydRelax2D.generated.h"
 
 /**
@@ -41,6 +42,11 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=1))
 	int32 Iterations = 5;
 
+	/** Keep the previous iteration's triangulation as long as it is still valid for the relaxed positions, instead of rebuilding it every iteration.
+	 * Points move less and less as relaxation converges, so later iterations mostly skip triangulation entirely. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta = (PCG_NotOverridable, AdvancedDisplay))
+	bool bReuseTriangulation = true;
+
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
@@ -79,6 +85,12 @@ namespace PCGExLloydRelax2D
 
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
 
+		TUniquePtr<PCGExGeo::TDelaunay2> Delaunay;
+		TArray<int32> SiteOffsets; // Per point, range in PointSites
+		TArray<int32> PointSites;  // Sites using each point, in ascending order
+		TArray<FVector> Centroids;
+		int32 RemainingIterations = 0;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
@@ -86,6 +98,10 @@ namespace PCGExLloydRelax2D
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
+		void StartIteration();
+		bool UpdateTriangulation();
+		void ComputeCentroids();
+		void ApplyCentroids();
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
 	};
@@ -94,19 +110,13 @@ namespace PCGExLloydRelax2D
 	{
 	public:
 		FLloydRelaxTask(const int32 InTaskIndex,
-		                const TSharedPtr<FProcessor>& InProcessor,
-		                const FPCGExInfluenceDetails* InInfluenceSettings,
-		                const int32 InNumIterations) :
+		                const TSharedPtr<FProcessor>& InProcessor) :
 			FPCGExIndexedTask(InTaskIndex),
-			Processor(InProcessor),
-			InfluenceSettings(InInfluenceSettings),
-			NumIterations(InNumIterations)
+			Processor(InProcessor)
 		{
 		}
 
 		TSharedPtr<FProcessor> Processor;
-		const FPCGExInfluenceDetails* InfluenceSettings = nullptr;
-		int32 NumIterations = 0;
 
 		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override;
 	};
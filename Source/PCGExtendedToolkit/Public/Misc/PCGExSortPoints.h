@@ -77,7 +77,12 @@ namespace PCGExSortPoints
 {
 	class FProcessor final : public PCGExPointsMT::TPointsProcessor<FPCGExPointsProcessorContext, UPCGExSortPointsBaseSettings>
 	{
-		TSharedPtr<PCGExSorting::PointSorter<true>> Sorter;
+		TSharedPtr<PCGExSorting::PointSorter<false>> Sorter;
+
+		// Points are sorted through an index permutation, in parallel runs merged pairwise
+		TArray<int32> Order;
+		TArray<int32> MergeBuffer;
+		TArray<PCGExMT::FScope> Runs;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
@@ -91,6 +96,9 @@ namespace PCGExSortPoints
 
 		virtual void RegisterBuffersDependencies(PCGExData::FFacadePreloader& FacadePreloader) override;
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
+		void MergeRuns();
+		void MergeRunPair(const int32 PairIndex);
+		void ApplyOrder();
 		virtual void CompleteWork() override;
 	};
 }
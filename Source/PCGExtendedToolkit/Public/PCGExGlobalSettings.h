@@ -74,6 +74,10 @@ public:
 	int32 ClusterDefaultBatchChunkSize = 512;
 	int32 GetClusterBatchChunkSize(const int32 In = -1) const { return In <= -1 ? ClusterDefaultBatchChunkSize : In; }
 
+	/** Store cluster adjacency in a single flat buffer instead of one array per node. Faster to build & traverse, lighter in memory. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bFlatClusterAdjacency = true;
+
 	/** Allow caching of clusters */
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
 	bool bCacheClusters = true;
@@ -94,6 +98,14 @@ public:
 	EPCGExAsyncPriority DefaultWorkPriority = EPCGExAsyncPriority::BackgroundNormal;
 	EPCGExAsyncPriority GetDefaultWorkPriority() const { return DefaultWorkPriority == EPCGExAsyncPriority::Default ? EPCGExAsyncPriority::BackgroundNormal : DefaultWorkPriority; }
 
+	/** When enabled, parallel loops launch about one worker per core that claim & steal scopes, instead of one task per scope. Daisy-chained loops are unaffected. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
+	bool bUseWorkStealingScheduler = false;
+
+	/** Max number of workers per task group when using the work-stealing scheduler. 0 or -1 use the number of worker threads. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Async", meta=(ClampMin=-1, EditCondition="bUseWorkStealingScheduler"))
+	int32 MaxWorkStealingWorkers = -1;
+
 	/** Disable collision on new entries */
 	UPROPERTY(EditAnywhere, config, Category = "Collections")
 	bool bDisableCollisionByDefault = true;
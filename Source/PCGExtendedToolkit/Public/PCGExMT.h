@@ -284,6 +284,7 @@ namespace PCGExMT
 		friend class FSimpleCallbackTask;
 		friend class FScopeIterationTask;
 		friend class FDaisyChainScopeIterationTask;
+		friend class FWorkStealingScopeTask;
 
 	public:
 		using FSimpleCallback = std::function<void()>;
@@ -344,8 +345,22 @@ namespace PCGExMT
 		TArray<FSimpleCallback> SimpleCallbacks;
 		TArray<FScope> Loops;
 
+		// Work-stealing state, one packed [Start, End[ range of loop indices per worker
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FWorkerRange
+		{
+			std::atomic<uint64> Range{0};
+		};
+
+		int32 NumWorkers = 0;
+		TUniquePtr<FWorkerRange[]> WorkerRanges;
+
 		void ExecScopeIterations(const FScope& Scope, bool bPrepareOnly) const;
 
+		bool TryStartWorkStealing(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly);
+		void ExecWorkStealing(const int32 WorkerIndex, const bool bPrepareOnly);
+		bool ClaimLoopIndex(const int32 WorkerIndex, int32& OutLoopIndex) const;
+		bool StealLoopIndex(const int32 WorkerIndex, int32& OutLoopIndex) const;
+
 		template <typename T>
 		void LaunchWithPreparation(TSharedPtr<T> InTask, const bool bPrepareOnly)
 		{
@@ -435,6 +450,20 @@ namespace PCGExMT
 		virtual void ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager) override;
 	};
 
+	class FWorkStealingScopeTask final : public FPCGExIndexedTask
+	{
+	public:
+		PCGEX_ASYNC_TASK_NAME(FWorkStealingScopeTask)
+
+		explicit FWorkStealingScopeTask(const int32 InTaskIndex):
+			FPCGExIndexedTask(InTaskIndex)
+		{
+		}
+
+		bool bPrepareOnly = false;
+		virtual void ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager) override;
+	};
+
 	template <typename T>
 	class /*PCGEXTENDEDTOOLKIT_API*/ FWriteTask final : public FTask
 	{
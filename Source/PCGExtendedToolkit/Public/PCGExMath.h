@@ -479,6 +479,58 @@ namespace PCGExMath
 		}
 	}
 
+	/**
+	 * Accumulates min/max over a contiguous range.
+	 * Arithmetic types are reduced over independent lanes so the compiler can vectorize the loop.
+	 */
+	template <typename T>
+	FORCEINLINE static void MinMaxRange(const T* Data, const int32 Num, T& InOutMin, T& InOutMax)
+	{
+		if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+		{
+			constexpr int32 Lanes = 8;
+
+			T LaneMin[Lanes];
+			T LaneMax[Lanes];
+			for (int l = 0; l < Lanes; l++)
+			{
+				LaneMin[l] = InOutMin;
+				LaneMax[l] = InOutMax;
+			}
+
+			const int32 NumPacked = Num - Num % Lanes;
+			for (int32 i = 0; i < NumPacked; i += Lanes)
+			{
+				for (int l = 0; l < Lanes; l++)
+				{
+					const T V = Data[i + l];
+					LaneMin[l] = V < LaneMin[l] ? V : LaneMin[l];
+					LaneMax[l] = V > LaneMax[l] ? V : LaneMax[l];
+				}
+			}
+
+			for (int32 i = NumPacked; i < Num; i++)
+			{
+				LaneMin[0] = FMath::Min(Data[i], LaneMin[0]);
+				LaneMax[0] = FMath::Max(Data[i], LaneMax[0]);
+			}
+
+			for (int l = 0; l < Lanes; l++)
+			{
+				InOutMin = FMath::Min(LaneMin[l], InOutMin);
+				InOutMax = FMath::Max(LaneMax[l], InOutMax);
+			}
+		}
+		else
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				InOutMin = Min(Data[i], InOutMin);
+				InOutMax = Max(Data[i], InOutMax);
+			}
+		}
+	}
+
 	template <typename T>
 	FORCEINLINE static T Add(const T& A, const T& B)
 	{
@@ -1329,5 +1381,22 @@ namespace PCGExMath
 		}
 	}
 
+	/**
+	 * Upper bound on how far GetSpatializedCenter may land from the point location, whatever the other end is.
+	 * Lets spatial queries prune on point locations alone while staying exact for bounds-based distances.
+	 */
+	FORCEINLINE static double GetSpatializedReach(const EPCGExDistance Mode, const FPCGPoint& Point)
+	{
+		switch (Mode)
+		{
+		case EPCGExDistance::SphereBounds:
+			return Point.GetScaledExtents().Length();
+		case EPCGExDistance::BoxBounds:
+			return FVector::Max(Point.BoundsMin.GetAbs(), Point.BoundsMax.GetAbs()).Length() * Point.Transform.GetMaximumAxisScale();
+		default:
+			return 0;
+		}
+	}
+
 #pragma endregion
 }
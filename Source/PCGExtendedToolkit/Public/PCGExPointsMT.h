@@ -260,7 +260,7 @@ namespace PCGExPointsMT
 
 		virtual void FilterScope(const PCGExMT::FScope& Scope)
 		{
-			if (PrimaryFilters) { for (int i = Scope.Start; i < Scope.End; i++) { PointFilterCache[i] = PrimaryFilters->Test(i); } }
+			if (PrimaryFilters) { PrimaryFilters->TestScope(Scope, PointFilterCache); }
 		}
 
 		virtual void FilterAll() { FilterScope(PCGExMT::FScope(0, PointDataFacade->GetNum())); }
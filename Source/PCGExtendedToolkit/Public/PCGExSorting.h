@@ -131,6 +131,10 @@ namespace PCGExSorting
 		TArray<TSharedRef<FPCGExSortRule>> Rules;
 		TMap<PCGMetadataEntryKey, int32> PointIndices;
 
+		// Rule values packed point by point, see InitKeys
+		TArray<double> Keys;
+		int32 NumRules = 0;
+
 	public:
 		EPCGExSortDirection SortDirection = EPCGExSortDirection::Ascending;
 		TSharedRef<PCGExData::FFacade> DataFacade;
@@ -249,6 +253,48 @@ namespace PCGExSorting
 		{
 			return Sort(PointIndices[A.MetadataEntry], PointIndices[B.MetadataEntry]);
 		}
+
+		/**
+		 * Allocates a packed copy of every rule value, so SortKeyed only reads from a flat array.
+		 * Keys must then be extracted for every scope that will be compared.
+		 */
+		void InitKeys()
+		{
+			NumRules = Rules.Num();
+			Keys.SetNumUninitialized(DataFacade->GetNum() * NumRules);
+		}
+
+		void ExtractKeys(const PCGExMT::FScope& Scope)
+		{
+			for (int r = 0; r < NumRules; r++)
+			{
+				const TSharedPtr<PCGExData::TBuffer<double>>& Cache = Rules[r]->Cache;
+				for (int i = Scope.Start; i < Scope.End; i++) { Keys[i * NumRules + r] = Cache->Read(i); }
+			}
+		}
+
+		/** Same ordering as Sort, from extracted keys. Ties resolve to the lowest index so the ordering is deterministic. */
+		FORCEINLINE bool SortKeyed(const int32 A, const int32 B) const
+		{
+			const double* KeysA = Keys.GetData() + A * NumRules;
+			const double* KeysB = Keys.GetData() + B * NumRules;
+
+			int Result = 0;
+			for (int r = 0; r < NumRules; r++)
+			{
+				Result = FMath::IsNearlyEqual(KeysA[r], KeysB[r], Rules[r]->Tolerance) ? 0 : KeysA[r] < KeysB[r] ? -1 : 1;
+				if (Result != 0)
+				{
+					if (Rules[r]->bInvertRule) { Result *= -1; }
+					break;
+				}
+			}
+
+			if (Result == 0) { return A < B; }
+
+			if (SortDirection == EPCGExSortDirection::Descending) { Result *= -1; }
+			return Result < 0;
+		}
 	};
 
 	static TArray<FPCGExSortRuleConfig> GetSortingRules(FPCGExContext* InContext, const FName InLabel)
@@ -799,4 +799,54 @@ namespace PCGExPaths
 	{
 		return InSpline->GetTransformAtSplineInputKey(InSpline->FindInputKeyClosestToWorldLocation(InLocation), ESplineCoordinateSpace::World, bUseScale);
 	}
+
+#pragma region Spline Index
+
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FSplineSegmentBounds
+	{
+		FBoxSphereBounds Bounds = FBoxSphereBounds(ForceInit);
+		int32 SplineIndex = -1;
+		int32 SegmentIndex = -1;
+
+		FSplineSegmentBounds() = default;
+
+		FSplineSegmentBounds(const FBox& InBox, const int32 InSplineIndex, const int32 InSegmentIndex)
+			: Bounds(InBox), SplineIndex(InSplineIndex), SegmentIndex(InSegmentIndex)
+		{
+		}
+	};
+
+	PCGEX_OCTREE_SEMANTICS_REF(FSplineSegmentBounds, { return Element.Bounds;}, { return A.SplineIndex == B.SplineIndex && A.SegmentIndex == B.SegmentIndex; })
+
+	/**
+	 * Read-only spatial index over a set of splines, meant to be built once and shared across processors.
+	 * Each segment is bounded by the box of its bezier control hull, which always contains the curve,
+	 * so the distance to a segment box is a lower bound of the distance to the segment itself.
+	 * It is used to discard splines before running the (expensive) exact closest-point solve.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FSplineIndex : public TSharedFromThis<FSplineIndex>
+	{
+	protected:
+		const TArray<FPCGSplineStruct>* Splines = nullptr;
+		TUniquePtr<FSplineSegmentBoundsOctree> Octree;
+		FBox Bounds = FBox(ForceInit);
+		double SeedRadius = 1;
+
+	public:
+		/** Splines are referenced, not copied, and must outlive the index */
+		explicit FSplineIndex(const TArray<FPCGSplineStruct>& InSplines);
+
+		int32 Num() const { return Splines->Num(); }
+
+		/** Gathers sorted, unique indices of splines that may have points within Radius of Location. */
+		void FindWithinRadius(const FVector& Location, const double Radius, TArray<int32>& OutSplines) const;
+
+		/**
+		 * Gathers sorted, unique indices of splines that may hold the closest point to Location.
+		 * Any spline left out is farther than the closest solved candidate by more than Slack.
+		 */
+		void FindNearestCandidates(const FVector& Location, const double Slack, TArray<int32>& OutSplines) const;
+	};
+
+#pragma endregion
 }
@@ -10,6 +10,7 @@
 
 
 #include "Smoothing/PCGExSmoothingOperation.h"
+#include "Smoothing/PCGExWindowKernel.h"
 #include "PCGExSmooth.generated.h"
 
 /**
@@ -114,6 +115,16 @@ namespace PCGExSmooth
 		UPCGExSmoothingOperation* TypedOperation = nullptr;
 		bool bClosedLoop = false;
 
+		// Whole-path evaluation of linear channels; whatever it can't handle is left to the per-point blender
+		TSharedPtr<FWindowKernel> WindowKernel;
+		FPCGExBlendingDetails ResidualBlending;
+		FPCGExPropertiesBlendingDetails KernelProperties;
+		TArray<PCGEx::FAttributeIdentity> KernelAttributes;
+		TArray<EPCGExDataBlendingType> KernelAttributesBlending;
+		TSet<FName> KernelAttributeNames;
+		TArray<int8> KernelMask;
+		bool bHasResidualBlending = true;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
@@ -126,5 +137,9 @@ namespace PCGExSmooth
 		virtual void PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope) override;
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
+
+	protected:
+		void InitWindowKernel(const int32 Window);
+		void ApplyWindowKernel();
 	};
 }
@@ -65,4 +65,10 @@ public:
 
 		MetadataBlender->CompleteBlending(Target, Count, TotalWeight);
 	}
+
+	virtual int32 GetKernelWindow(const double Smoothing) const override
+	{
+		const int32 SmoothingInt = Smoothing;
+		return SmoothingInt == 0 ? 0 : FMath::Max(1, SmoothingInt);
+	}
 };
@@ -26,4 +26,10 @@ public:
 		const bool bClosedLoop)
 	{
 	}
+
+	/**
+	 * Index window this operation boils down to for a constant smoothing amount, if it can be evaluated
+	 * as a whole-path PCGExSmooth::FWindowKernel instead of point by point. -1 if it can't, 0 if it's a no-op.
+	 */
+	virtual int32 GetKernelWindow(const double Smoothing) const { return -1; }
 };
@@ -0,0 +1,136 @@
+﻿// Copyright 2024 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExHelpers.h"
+#include "PCGExMath.h"
+#include "Data/Blending/PCGExDataBlending.h"
+
+namespace PCGExSmooth
+{
+	template <typename T>
+	constexpr bool IsWindowKernelType = std::is_same_v<T, float> || std::is_same_v<T, double> ||
+		std::is_same_v<T, FVector2D> || std::is_same_v<T, FVector> || std::is_same_v<T, FVector4>;
+
+	/**
+	 * Index-window smoothing evaluated over a whole path at once.
+	 * The Moving Average kernel -- weights falling off linearly from the center, (1 - |i| / Window) -- is rebuilt
+	 * from two nested running box sums, and plain averaging from a single one, so cost is O(N) whatever the window.
+	 * Closed loops wrap around; open paths drop out-of-range samples, exactly like the per-point version.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FWindowKernel : public TSharedFromThis<FWindowKernel>
+	{
+	protected:
+		int32 NumPoints = 0;
+		int32 Window = 0;
+		bool bClosedLoop = false;
+
+		TArray<double> Counts;       // Samples in [i - Window, i + Window]
+		TArray<double> TotalWeights; // Kernel weights in that same range, scaled by Window
+
+	public:
+		FWindowKernel(const int32 InNumPoints, const int32 InWindow, const bool bInClosedLoop)
+			: NumPoints(InNumPoints), Window(FMath::Max(1, InWindow)), bClosedLoop(bInClosedLoop)
+		{
+			auto Presence = [&](const int32 At) -> double { return bClosedLoop || FMath::IsWithin(At, 0, NumPoints) ? 1 : 0; };
+			BoxSums(0.0, Presence, Counts);
+			TriangleSums(0.0, Presence, TotalWeights);
+		}
+
+		/** Whether a blend mode is linear enough to be evaluated as a window sum */
+		static bool Supports(const EPCGExDataBlendingType Blending)
+		{
+			return Blending == EPCGExDataBlendingType::Average || Blending == EPCGExDataBlendingType::Weight;
+		}
+
+		static bool Supports(const EPCGExDataBlendingType Blending, const EPCGMetadataTypes Type)
+		{
+			if (!Supports(Blending)) { return false; }
+			return Type == EPCGMetadataTypes::Float || Type == EPCGMetadataTypes::Double ||
+				Type == EPCGMetadataTypes::Vector2 || Type == EPCGMetadataTypes::Vector || Type == EPCGMetadataTypes::Vector4;
+		}
+
+		/** Smooths every value of In into Out, which must be the same size. */
+		template <typename T>
+		void Smooth(const TConstArrayView<T>& In, const EPCGExDataBlendingType Blending, TArray<T>& Out) const
+		{
+			static_assert(IsWindowKernelType<T>, "Unsupported window kernel type");
+			using FAcc = std::conditional_t<std::is_arithmetic_v<T>, double, T>;
+
+			// Values are centered on the first one to keep running sums small, the kernel being normalized
+			const FAcc Origin = static_cast<FAcc>(In[0]);
+			const FAcc Zero = Origin * 0.0;
+
+			auto Sample = [&](const int32 At) -> FAcc
+			{
+				if (bClosedLoop) { return static_cast<FAcc>(In[PCGExMath::Tile(At, 0, NumPoints - 1)]) - Origin; }
+				return FMath::IsWithin(At, 0, NumPoints) ? static_cast<FAcc>(In[At]) - Origin : Zero;
+			};
+
+			TArray<FAcc> Sums;
+			PCGEx::InitArray(Out, NumPoints);
+
+			if (Blending == EPCGExDataBlendingType::Average)
+			{
+				BoxSums(Zero, Sample, Sums);
+				for (int i = 0; i < NumPoints; i++) { Out[i] = static_cast<T>(Origin + Sums[i] / Counts[i]); }
+			}
+			else
+			{
+				TriangleSums(Zero, Sample, Sums);
+				for (int i = 0; i < NumPoints; i++) { Out[i] = static_cast<T>(Origin + Sums[i] / TotalWeights[i]); }
+			}
+		}
+
+	protected:
+		/** Sum of the 2 * Window + 1 samples centered on each point */
+		template <typename FAcc, typename FSampleFunc>
+		void BoxSums(const FAcc& Zero, FSampleFunc&& Sample, TArray<FAcc>& OutSums) const
+		{
+			PCGEx::InitArray(OutSums, NumPoints);
+
+			FAcc Sum = Zero;
+			for (int32 i = -Window; i <= Window; i++) { Sum += Sample(i); }
+
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				OutSums[i] = Sum;
+				Sum += Sample(i + Window + 1) - Sample(i - Window);
+			}
+		}
+
+		/**
+		 * Samples centered on each point, weighted by (Window - |offset|).
+		 * That triangle is the sum of Window consecutive boxes of Window samples, each box being itself a running sum.
+		 */
+		template <typename FAcc, typename FSampleFunc>
+		void TriangleSums(const FAcc& Zero, FSampleFunc&& Sample, TArray<FAcc>& OutSums) const
+		{
+			// Boxes[j + Window - 1] covers samples [j, j + Window - 1], for j in [1 - Window, NumPoints - 1]
+			TArray<FAcc> Boxes;
+			PCGEx::InitArray(Boxes, NumPoints + Window - 1);
+
+			FAcc Box = Zero;
+			for (int32 i = 1 - Window; i <= 0; i++) { Box += Sample(i); }
+
+			for (int32 j = 1 - Window; j < NumPoints; j++)
+			{
+				Boxes[j + Window - 1] = Box;
+				Box += Sample(j + Window) - Sample(j);
+			}
+
+			PCGEx::InitArray(OutSums, NumPoints);
+
+			FAcc Sum = Zero;
+			for (int32 j = 0; j < Window; j++) { Sum += Boxes[j]; }
+
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				OutSums[i] = Sum;
+				if (i + 1 < NumPoints) { Sum += Boxes[i + Window] - Boxes[i]; }
+			}
+		}
+	};
+}
@@ -11,6 +11,7 @@
 #include "PCGExDetails.h"
 #include "Data/Blending/PCGExDataBlending.h"
 #include "Data/Blending/PCGExMetadataBlender.h"
+#include "Geometry/PCGExGeoPointIndex.h"
 
 #include "PCGExSampleNearestPoint.generated.h"
 
@@ -305,7 +306,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleNearestPointContext final : FPCGEx
 
 	TSharedPtr<PCGExData::FFacadePreloader> TargetsPreloader;
 	TSharedPtr<PCGExData::FFacade> TargetsFacade;
-	const UPCGPointData::PointOctree* TargetOctree = nullptr;
+	TSharedPtr<PCGExGeo::FPointKNNIndex> TargetIndex;
 	TSharedPtr<PCGExSorting::PointSorter<false>> Sorter;
 
 	TSharedPtr<PCGExDetails::FDistances> DistanceDetails;
@@ -345,6 +346,7 @@ namespace PCGExSampleNearestPoints
 
 		bool bSingleSample = false;
 		bool bSampleClosest = false;
+		bool bSampleExtremes = false;
 
 		TSharedPtr<PCGExData::TBuffer<double>> RangeMinGetter;
 		TSharedPtr<PCGExData::TBuffer<double>> RangeMaxGetter;
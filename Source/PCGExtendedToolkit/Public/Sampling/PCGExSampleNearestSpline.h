@@ -14,6 +14,11 @@
 
 #include "PCGExSampleNearestSpline.generated.h"
 
+namespace PCGExPaths
+{
+	class FSplineIndex;
+}
+
 #define PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(MACRO)\
 MACRO(Success, bool, false)\
 MACRO(Transform, FTransform, FTransform::Identity)\
@@ -90,7 +95,11 @@ namespace PCGExPolyLine
 
 		void Update(const FSample& Infos, bool& IsNewClosest, bool& IsNewFarthest);
 
-		FORCEINLINE double GetRangeRatio(const double Distance) const { return FMath::Clamp(Distance - SampledRangeMin, 0, SampledRangeWidth) / SampledRangeWidth; }
+		FORCEINLINE double GetRangeRatio(const double Distance) const
+		{
+			// A single sampled distance has no width; it sits at the start of its own range
+			return SampledRangeWidth > 0 ? FMath::Clamp(Distance - SampledRangeMin, 0, SampledRangeWidth) / SampledRangeWidth : 0;
+		}
 		FORCEINLINE bool IsValid() const { return UpdateCount > 0; }
 	};
 }
@@ -395,6 +404,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleNearestSplineContext final : FPCGE
 	TArray<FPCGSplineStruct> Splines;
 	TArray<double> SegmentCounts;
 	TArray<double> Lengths;
+	TSharedPtr<PCGExPaths::FSplineIndex> SplineIndex;
 
 	int64 NumTargets = 0;
 
@@ -441,6 +451,10 @@ namespace PCGExSampleNearestSpline
 		bool bOnlySignIfClosed = false;
 		bool bOnlyIncrementInsideNumIfClosed = false;
 
+		// Whether targets can be discarded through the spline index before being sampled
+		bool bPruneByRange = false;
+		bool bPruneByNearest = false;
+
 		PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_DECL)
 
 	public:
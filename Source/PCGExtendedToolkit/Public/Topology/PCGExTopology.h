@@ -357,6 +357,34 @@ namespace PCGExTopology
 
 	class FCell;
 
+	/**
+	 * Planar half-edge structure of a cluster, built once from projected positions.
+	 * Half-edges are grouped per node and sorted by angle around it. Next turns onto the first link found clockwise
+	 * from the one just arrived through -- the same rule FCell walks by -- so every face is exactly one orbit of Next.
+	 */
+	class FPlanarFaces : public TSharedFromThis<FPlanarFaces>
+	{
+	protected:
+		TArray<int32> NodeOffsets; // First half-edge of each node, plus the total
+
+	public:
+		struct FHalfEdge
+		{
+			int32 From = -1;
+			int32 To = -1;
+			int32 Edge = -1;
+		};
+
+		TArray<FHalfEdge> HalfEdges;
+		TArray<int32> Next;
+		TArray<int32> FaceIndices; // Face of each half-edge, negative if it doesn't close up
+		TArray<int32> Faces;       // Lowest half-edge of each face
+
+		explicit FPlanarFaces(const TSharedRef<PCGExCluster::FCluster>& InCluster, const TArray<FVector>& ProjectedPositions);
+
+		int32 FindHalfEdge(const int32 FromNode, const int32 Edge) const;
+	};
+
 	class FHoles : public TSharedFromThis<FHoles>
 	{
 	protected:
@@ -507,7 +535,8 @@ namespace PCGExTopology
 		ECellResult BuildFromCluster(
 			const PCGExGraph::FLink InSeedLink,
 			TSharedRef<PCGExCluster::FCluster> InCluster,
-			const TArray<FVector>& ProjectedPositions);
+			const TArray<FVector>& ProjectedPositions,
+			const FPlanarFaces* PlanarFaces = nullptr);
 
 		ECellResult BuildFromCluster(
 			const FVector& SeedPosition,